@@ -0,0 +1,274 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/// @file road_geometry_benchmark.cc
+/// Micro-benchmarks of the core api::RoadGeometry and api::Lane queries across maliput backends.
+///
+/// Each road network is loaded once, via LoadRoadNetwork(), the first time one of its benchmarks runs. Queries are
+/// evaluated at positions sampled on the lanes, uniformly by length, and perturbed off their surface as vehicle
+/// poses usually are. Benchmarks are named `<query>/<road network>`, so e.g. `--benchmark_filter=ToRoadPosition/`
+/// compares a query across backends and `--benchmark_filter=/dragway` compares the queries of a backend.
+
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+
+#include "integration/synthetic_road_network.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Number of query positions sampled per road network. Benchmarks cycle over them.
+constexpr int kNumSamples{4096};
+// Seed of the position sampling, so that runs are comparable.
+constexpr unsigned int kSeed{42};
+// Standard deviation of the perturbation added to the sampled positions, in meters.
+constexpr double kPerturbationStdDev{0.5};
+// Radius used by FindRoadPositions, in meters.
+constexpr double kFindRoadPositionsRadius{2.};
+
+// A road network to benchmark.
+struct BenchmarkCase {
+  std::string name;
+  RoadNetworkDescriptor descriptor;
+  // When set, the road network is a synthetic grid instead of the one `descriptor` describes.
+  std::optional<SyntheticRoadNetworkProperties> synthetic_properties;
+};
+
+// A query position, sampled on a lane.
+struct Sample {
+  const api::Lane* lane{};
+  api::LanePosition lane_position;
+  // Position of `lane_position` in the inertial frame, perturbed off the lane surface.
+  api::InertialPosition inertial_position;
+};
+
+// A loaded road network and the query positions sampled on it.
+struct Fixture {
+  std::unique_ptr<api::RoadNetwork> road_network;
+  std::vector<Sample> samples;
+};
+
+// @returns The road networks to benchmark.
+std::vector<BenchmarkCase> MakeBenchmarkCases() {
+  std::vector<BenchmarkCase> cases;
+  for (const int num_lanes : {1, 4, 16}) {
+    for (const double length : {100., 1000.}) {
+      BenchmarkCase dragway_case;
+      dragway_case.name = "dragway_" + std::to_string(num_lanes) + "x" + std::to_string(static_cast<int>(length));
+      dragway_case.descriptor.maliput_implementation = MaliputImplementation::kDragway;
+      dragway_case.descriptor.dragway_build_properties.num_lanes = num_lanes;
+      dragway_case.descriptor.dragway_build_properties.length = length;
+      cases.push_back(dragway_case);
+    }
+  }
+  for (const std::string yaml_file : {"2x2_intersection.yaml"}) {
+    BenchmarkCase multilane_case;
+    multilane_case.name = "multilane_" + yaml_file;
+    multilane_case.descriptor.maliput_implementation = MaliputImplementation::kMultilane;
+    multilane_case.descriptor.multilane_build_properties.yaml_file = yaml_file;
+    cases.push_back(multilane_case);
+  }
+  for (const std::string xodr_file : {"ArcLane.xodr", "LShapeRoad.xodr", "TShapeRoad.xodr", "Town04.xodr"}) {
+    BenchmarkCase malidrive_case;
+    malidrive_case.name = "malidrive_" + xodr_file;
+    malidrive_case.descriptor.maliput_implementation = MaliputImplementation::kMalidrive;
+    malidrive_case.descriptor.malidrive_build_properties.xodr_file_path = xodr_file;
+    malidrive_case.descriptor.malidrive_build_properties.geometry_only = true;
+    cases.push_back(malidrive_case);
+  }
+  for (const std::string osm_file : {"straight_forward.osm"}) {
+    BenchmarkCase osm_case;
+    osm_case.name = "osm_" + osm_file;
+    osm_case.descriptor.maliput_implementation = MaliputImplementation::kOsm;
+    osm_case.descriptor.maliput_osm_build_properties.osm_file = osm_file;
+    osm_case.descriptor.maliput_osm_build_properties.geometry_only = true;
+    cases.push_back(osm_case);
+  }
+  for (const int size : {10, 30}) {
+    BenchmarkCase synthetic_case;
+    synthetic_case.name = "synthetic_" + std::to_string(size) + "x" + std::to_string(size);
+    synthetic_case.synthetic_properties = SyntheticRoadNetworkProperties{size, size};
+    cases.push_back(synthetic_case);
+  }
+  return cases;
+}
+
+// @returns The query positions sampled on the lanes of @p road_geometry.
+std::vector<Sample> SampleLanes(const api::RoadGeometry* road_geometry) {
+  std::vector<const api::Lane*> lanes;
+  std::vector<double> lengths;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        lanes.push_back(segment->lane(k));
+        lengths.push_back(segment->lane(k)->length());
+      }
+    }
+  }
+  std::vector<Sample> samples;
+  if (lanes.empty()) {
+    return samples;
+  }
+  std::mt19937 generator(kSeed);
+  std::discrete_distribution<std::size_t> lane_distribution(lengths.begin(), lengths.end());
+  std::uniform_real_distribution<double> unit_distribution(0., 1.);
+  std::normal_distribution<double> perturbation_distribution(0., kPerturbationStdDev);
+  samples.reserve(kNumSamples);
+  for (int i = 0; i < kNumSamples; ++i) {
+    const api::Lane* lane = lanes[lane_distribution(generator)];
+    const double s = unit_distribution(generator) * lane->length();
+    const api::RBounds r_bounds = lane->lane_bounds(s);
+    const double r = r_bounds.min() + unit_distribution(generator) * (r_bounds.max() - r_bounds.min());
+    const api::LanePosition lane_position(s, r, 0.);
+    const api::InertialPosition on_lane = lane->ToInertialPosition(lane_position);
+    const api::InertialPosition inertial_position(on_lane.x() + perturbation_distribution(generator),
+                                                  on_lane.y() + perturbation_distribution(generator),
+                                                  on_lane.z() + std::abs(perturbation_distribution(generator)));
+    samples.push_back({lane, lane_position, inertial_position});
+  }
+  return samples;
+}
+
+// @returns The Fixture of @p benchmark_case, loading it the first time.
+const Fixture& GetFixture(const BenchmarkCase& benchmark_case) {
+  static std::map<std::string, Fixture> fixtures;
+  auto it = fixtures.find(benchmark_case.name);
+  if (it == fixtures.end()) {
+    const RoadNetworkDescriptor& descriptor = benchmark_case.descriptor;
+    Fixture fixture;
+    fixture.road_network =
+        benchmark_case.synthetic_properties.has_value()
+            ? CreateSyntheticRoadNetwork(*benchmark_case.synthetic_properties)
+            : LoadRoadNetwork(descriptor.maliput_implementation, descriptor.dragway_build_properties,
+                              descriptor.multilane_build_properties, descriptor.malidrive_build_properties,
+                              descriptor.maliput_osm_build_properties);
+    fixture.samples = SampleLanes(fixture.road_network->road_geometry());
+    it = fixtures.emplace(benchmark_case.name, std::move(fixture)).first;
+  }
+  return it->second;
+}
+
+// A query to benchmark: it evaluates the query at a sample and keeps its result from being optimized away.
+using Query = std::function<void(const api::RoadGeometry*, const Sample&)>;
+
+// Runs @p query over the samples of @p benchmark_case, cycling over them.
+void RunQuery(benchmark::State& state, const BenchmarkCase& benchmark_case, const Query& query) {
+  const Fixture& fixture = GetFixture(benchmark_case);
+  if (fixture.samples.empty()) {
+    state.SkipWithError("The road network has no lanes.");
+    return;
+  }
+  const api::RoadGeometry* road_geometry = fixture.road_network->road_geometry();
+  std::size_t index{0};
+  for (auto _ : state) {
+    query(road_geometry, fixture.samples[index]);
+    index = (index + 1) % fixture.samples.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// @returns The queries to benchmark, keyed by name.
+std::map<std::string, Query> MakeQueries() {
+  return {
+      {"ToRoadPosition",
+       [](const api::RoadGeometry* road_geometry, const Sample& sample) {
+         benchmark::DoNotOptimize(road_geometry->ToRoadPosition(sample.inertial_position));
+       }},
+      {"ToLanePosition",
+       [](const api::RoadGeometry*, const Sample& sample) {
+         benchmark::DoNotOptimize(sample.lane->ToLanePosition(sample.inertial_position));
+       }},
+      {"ToInertialPosition",
+       [](const api::RoadGeometry*, const Sample& sample) {
+         benchmark::DoNotOptimize(sample.lane->ToInertialPosition(sample.lane_position));
+       }},
+      {"GetOrientation",
+       [](const api::RoadGeometry*, const Sample& sample) {
+         benchmark::DoNotOptimize(sample.lane->GetOrientation(sample.lane_position));
+       }},
+      {"FindRoadPositions",
+       [](const api::RoadGeometry* road_geometry, const Sample& sample) {
+         benchmark::DoNotOptimize(road_geometry->FindRoadPositions(sample.inertial_position, kFindRoadPositionsRadius));
+       }},
+      {"LaneBounds",
+       [](const api::RoadGeometry*, const Sample& sample) {
+         benchmark::DoNotOptimize(sample.lane->lane_bounds(sample.lane_position.s()));
+       }},
+      {"ByIdGetLane",
+       [](const api::RoadGeometry* road_geometry, const Sample& sample) {
+         benchmark::DoNotOptimize(road_geometry->ById().GetLane(sample.lane->id()));
+       }},
+  };
+}
+
+// Registers a benchmark per query and road network.
+void RegisterBenchmarks() {
+  const std::vector<BenchmarkCase> benchmark_cases = MakeBenchmarkCases();
+  for (const auto& name_query : MakeQueries()) {
+    for (const BenchmarkCase& benchmark_case : benchmark_cases) {
+      const Query query = name_query.second;
+      benchmark::RegisterBenchmark((name_query.first + "/" + benchmark_case.name).c_str(),
+                                   [benchmark_case, query](benchmark::State& state) {
+                                     RunQuery(state, benchmark_case, query);
+                                   });
+    }
+  }
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
+
+int main(int argc, char** argv) {
+  maliput::integration::RegisterBenchmarks();
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
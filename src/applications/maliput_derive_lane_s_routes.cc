@@ -31,7 +31,7 @@
 /// @file maliput_derive_lane_s_routes.cc
 ///
 /// Builds an api::RoadGeometry and returns a set of LaneSRoute objects that go from the start waypoint to
-/// end one. Possible backends are `dragway`, `multilane` and `malidrive`.
+/// end one, through any intermediate waypoints. Possible backends are `dragway`, `multilane` and `malidrive`.
 ///
 /// @note
 /// 1. Allows to load a road geometry from different road geometry implementations.
@@ -47,10 +47,25 @@
 ///      i - It should have a valid xodr_file only when malidrive backend is selected.
 ///     ii - If a xodr_file_path(gflag) is provided then the xodr file path described in the config_file is discarded.
 /// 3. The level of the logger could be setted by: -log_level.
-
+/// 4. The config_file could list more than two waypoints. Routes between each pair of consecutive waypoints are then
+///    stitched, up to -max_num_routes combinations.
+/// 5. Many routing jobs could be run against the same road network by providing them in the file given by -jobs_file.
+///    Jobs run on -route_threads threads and their routes are printed in job order, as they become available.
+/// 6. Unless -use_lane_graph is false, the lane connectivity is flattened into a LaneGraph once, after loading, and
+///    routes are derived on it rather than by walking the branch points of the road geometry on every leg.
+/// 7. -routing_mode selects which routes are derived: all of them, the shortest one or the -num_routes shortest ones.
+///    Shortest routes are searched best-first on the LaneGraph, and printed in ascending length order.
+/// 8. When -route_cache_mb is positive, the routes between consecutive waypoints are cached, so that repeated jobs
+///    between nearby positions on the same lanes reuse them. See integration::RouteCache. It is only supported when
+///    -routing_mode is all, as cached shortest routes are only ranked for the waypoints they were derived for.
+
+#include <chrono>
 #include <cmath>
+#include <cstddef>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -61,10 +76,14 @@
 #include <maliput/api/road_geometry.h>
 #include <maliput/api/road_network.h>
 #include <maliput/common/logger.h>
-#include <maliput/routing/derive_lane_s_routes.h>
+#include <maliput/common/maliput_throw.h>
 #include <maliput/utility/generate_string.h>
 #include <yaml-cpp/yaml.h>
 
+#include "integration/lane_graph.h"
+#include "integration/route_cache.h"
+#include "integration/route_tools.h"
+#include "integration/thread_pool.h"
 #include "integration/tools.h"
 #include "maliput_gflags.h"
 
@@ -73,8 +92,7 @@ using maliput::api::LaneSRoute;
 using maliput::api::RoadGeometry;
 using maliput::api::RoadGeometryId;
 using maliput::api::RoadNetwork;
-using maliput::api::RoadPositionResult;
-using maliput::routing::DeriveLaneSRoutes;
+using maliput::api::RoadPosition;
 
 COMMON_PROPERTIES_FLAGS();
 MULTILANE_PROPERTIES_FLAGS();
@@ -89,6 +107,29 @@ DEFINE_string(config_file, "", "YAML file that defines XODR file path, route max
 DEFINE_double(max_length, 1000, "Maximum length of the intermediate lanes between start and end waypoints.[m]");
 DEFINE_string(start_waypoint, "", "Start waypoint to calculate the routing from. Expected format: '{x0, y0, z0}' ");
 DEFINE_string(end_waypoint, "", "End waypoint to calculate the routing to. Expected format: '{x1, y1, z1}' ");
+DEFINE_int32(max_num_routes, 1000,
+             "Maximum number of routes to derive. The combinations of routes between consecutive waypoints grow "
+             "exponentially with the number of waypoints.");
+DEFINE_string(jobs_file, "",
+              "File with routing jobs to run against the same road network, instead of a single one. YAML files hold "
+              "a 'jobs' sequence of maps with 'waypoints' and, optionally, 'max_length'. Other files are read as CSV, "
+              "one job per line: 'x0,y0,z0,x1,y1,z1,...[,max_length]'. When max_length is missing, the resolved one "
+              "is used.");
+DEFINE_int32(route_threads, 0, "Number of threads to run the jobs of --jobs_file on. When 0, all hardware threads.");
+DEFINE_bool(use_lane_graph, true,
+            "Whether to derive routes on a lane connectivity graph built once after loading, instead of walking the "
+            "branch points of the road geometry on every leg. Routes are the same either way. Shortest routes are "
+            "always derived on the graph.");
+DEFINE_string(routing_mode, "all",
+              "Which routes to derive: <all> routes under max_length, the <shortest> one or the <k_shortest> ones, "
+              "as many as --num_routes. Shortest routes are printed in ascending length order.");
+DEFINE_int32(num_routes, 3, "Number of routes to derive when --routing_mode is k_shortest.");
+DEFINE_int32(route_cache_mb, 0,
+             "Memory budget, in MB, of the cache of the routes between consecutive waypoints. When 0, routes are not "
+             "cached. Only supported when --routing_mode is all.");
+DEFINE_double(route_cache_s_bucket, 1.,
+              "Size of the buckets the s coordinates of the waypoints are quantized into, to look routes up in the "
+              "cache.[m]");
 
 namespace YAML {
 
@@ -126,27 +167,33 @@ constexpr const char* kWaypointKey = "waypoints";
 // Distances that differ by less than this (in meters) are considered equal.
 constexpr double kDistanceTolerance = 0.01;
 
-// Derives and returns a set of LaneSRoute objects that go from @p start to
-// @p end . If no routes are found, a vector of length zero is returned.
+// Derives and returns a set of LaneSRoute objects that go through @p waypoints, in order. If no routes are found, a
+// vector of length zero is returned.
 // Parameter @p max_length is the maximum length of the intermediate lanes
-// between @p start and @p end. See the description of maliput::routing::DeriveLaneSRoutes() for
-// more details. If @p start and @p end are the same lane, a route consisting
-// of one lane is returned regardless of @p max_length.
-std::vector<LaneSRoute> GetRoutes(const InertialPosition& start, const InertialPosition& end, const double max_length,
-                                  const RoadGeometry* road_geometry) {
-  const RoadPositionResult start_rp = road_geometry->ToRoadPosition(start);
-  const RoadPositionResult end_rp = road_geometry->ToRoadPosition(end);
-
-  maliput::log()->info("Start RoadPosition:");
-  maliput::log()->info("  - Lane: {}", start_rp.road_position.lane->id().string());
-  maliput::log()->info("  - s,r,h: ({}, {}, {})", start_rp.road_position.pos.s(), start_rp.road_position.pos.r(),
-                       start_rp.road_position.pos.h());
-  maliput::log()->info("End RoadPosition:");
-  maliput::log()->info("  - Lane: {}", end_rp.road_position.lane->id().string());
-  maliput::log()->info("  - s,r,h: ({}, {}, {})", end_rp.road_position.pos.s(), end_rp.road_position.pos.r(),
-                       end_rp.road_position.pos.h());
-
-  return DeriveLaneSRoutes(start_rp.road_position, end_rp.road_position, max_length);
+// between each pair of consecutive waypoints. See the description of maliput::routing::DeriveLaneSRoutes() for
+// more details. If two consecutive waypoints are on the same lane, a route consisting
+// of one lane is derived between them regardless of @p max_length. At most @p max_num_routes routes are returned:
+// any of them, or the shortest ones, depending on @p routing_mode.
+// Every waypoint is projected onto @p road_geometry once, even those shared by two legs. Legs are derived on
+// @p lane_graph, unless it is nullptr, which is only allowed when @p routing_mode is RoutingMode::kAll. Legs are
+// looked up in @p route_cache first, unless it is nullptr.
+std::vector<LaneSRoute> GetRoutes(const std::vector<InertialPosition>& waypoints, const double max_length,
+                                  int max_num_routes, RoutingMode routing_mode, const RoadGeometry* road_geometry,
+                                  const LaneGraph* lane_graph, RouteCache* route_cache) {
+  const std::vector<RoadPosition> road_positions = LocalizeWaypoints(road_geometry, waypoints);
+
+  for (std::size_t i = 0; i < road_positions.size(); ++i) {
+    maliput::log()->info("Waypoint {} RoadPosition:", i + 1);
+    maliput::log()->info("  - Lane: {}", road_positions[i].lane->id().string());
+    maliput::log()->info("  - s,r,h: ({}, {}, {})", road_positions[i].pos.s(), road_positions[i].pos.r(),
+                         road_positions[i].pos.h());
+  }
+
+  if (routing_mode == RoutingMode::kShortest) {
+    return DeriveShortestMultiWaypointLaneSRoutes(road_positions, max_length, max_num_routes, lane_graph,
+                                                  route_cache);
+  }
+  return DeriveMultiWaypointLaneSRoutes(road_positions, max_length, max_num_routes, lane_graph, route_cache);
 }
 
 // Serializes the @p routes computed by using the GetRoutes() method into a std::string.
@@ -184,6 +231,137 @@ std::string SerializeLaneSRoutes(const std::vector<LaneSRoute>& routes, const Ro
   return buffer.str();
 }
 
+// Reads the routing jobs of a jobs file, one at a time.
+//
+// CSV files are read line by line, so that arbitrarily large files can be processed with flat memory. YAML files are
+// parsed at once.
+class JobReader {
+ public:
+  // Opens @p file_path. @p default_max_length is used for jobs that lack one.
+  JobReader(const std::string& file_path, double default_max_length) : default_max_length_(default_max_length) {
+    const std::string extension = file_path.substr(file_path.find_last_of('.') + 1);
+    if (extension == "yaml" || extension == "yml") {
+      yaml_jobs_ = YAML::LoadFile(file_path)["jobs"];
+      if (!yaml_jobs_.IsSequence()) {
+        MALIPUT_THROW_MESSAGE("Jobs file: " + file_path + " lacks a 'jobs' sequence.");
+      }
+      is_yaml_ = true;
+    } else {
+      csv_.open(file_path);
+      if (!csv_.is_open()) {
+        MALIPUT_THROW_MESSAGE("Jobs file: " + file_path + " could not be opened.");
+      }
+    }
+  }
+
+  // @returns The next job, or std::nullopt when there are no more jobs.
+  // @throws maliput::common::assertion_error When a job is malformed.
+  std::optional<RouteJob> Next() { return is_yaml_ ? NextYamlJob() : NextCsvJob(); }
+
+ private:
+  std::optional<RouteJob> NextYamlJob() {
+    if (yaml_index_ == yaml_jobs_.size()) {
+      return std::nullopt;
+    }
+    const YAML::Node& job_node = yaml_jobs_[yaml_index_++];
+    if (!job_node[kWaypointKey].IsSequence()) {
+      MALIPUT_THROW_MESSAGE("Job " + std::to_string(yaml_index_) + " lacks a 'waypoints' sequence.");
+    }
+    RouteJob job;
+    for (const YAML::Node& waypoint_node : job_node[kWaypointKey]) {
+      job.waypoints.push_back(InertialPosition::FromXyz(waypoint_node.as<maliput::math::Vector3>()));
+    }
+    job.max_length = job_node[kMaxLengthKey].IsDefined() ? job_node[kMaxLengthKey].as<double>() : default_max_length_;
+    return job;
+  }
+
+  std::optional<RouteJob> NextCsvJob() {
+    std::string line;
+    while (std::getline(csv_, line)) {
+      ++csv_line_;
+      if (line.empty() || line.front() == '#') {
+        continue;
+      }
+      std::vector<double> values;
+      std::istringstream line_stream(line);
+      for (std::string field; std::getline(line_stream, field, ',');) {
+        values.push_back(std::stod(field));
+      }
+      if (values.size() < 6 || values.size() % 3 == 2) {
+        MALIPUT_THROW_MESSAGE("Jobs file line " + std::to_string(csv_line_) +
+                              " is not 'x0,y0,z0,x1,y1,z1,...[,max_length]'.");
+      }
+      RouteJob job;
+      for (std::size_t i = 0; i + 2 < values.size(); i += 3) {
+        job.waypoints.emplace_back(values[i], values[i + 1], values[i + 2]);
+      }
+      job.max_length = values.size() % 3 == 1 ? values.back() : default_max_length_;
+      return job;
+    }
+    return std::nullopt;
+  }
+
+  const double default_max_length_{};
+  bool is_yaml_{false};
+  YAML::Node yaml_jobs_;
+  std::size_t yaml_index_{0};
+  std::ifstream csv_;
+  int csv_line_{0};
+};
+
+// Runs the jobs in @p jobs_file against @p road_geometry and prints their routes, in job order, as they become
+// available. See GetRoutes() for @p max_num_routes, @p routing_mode, @p lane_graph and @p route_cache.
+// @returns False when the jobs file could not be read, true otherwise.
+bool RunJobsFile(const std::string& jobs_file, double max_length, int max_num_routes, RoutingMode routing_mode,
+                 const RoadGeometry* road_geometry, const LaneGraph* lane_graph, RouteCache* route_cache) {
+  std::optional<JobReader> reader;
+  try {
+    reader.emplace(jobs_file, max_length);
+  } catch (const std::exception& e) {
+    maliput::log()->error("{}", e.what());
+    return false;
+  }
+  ThreadPool thread_pool(FLAGS_route_threads);
+  maliput::log()->info("Running jobs of {} on {} threads...", jobs_file, thread_pool.num_threads());
+  int num_failed_jobs{0};
+  int num_jobs_without_routes{0};
+  const auto start = std::chrono::steady_clock::now();
+  std::size_t num_jobs{0};
+  try {
+    num_jobs = RunRouteJobs(
+        road_geometry, [&reader]() { return reader->Next(); }, max_num_routes,
+        // Enough jobs in flight to keep every thread busy while the oldest one is printed.
+        4 * thread_pool.num_threads(), &thread_pool,
+        [road_geometry, &num_failed_jobs, &num_jobs_without_routes](std::size_t index, const RouteJob&,
+                                                                     const RouteJobResult& result) {
+          std::cout << "Job " << (index + 1) << ":\n";
+          if (!result.error.empty()) {
+            ++num_failed_jobs;
+            std::cout << "Error: " << result.error << "\n";
+          } else if (result.routes.empty()) {
+            ++num_jobs_without_routes;
+            std::cout << "No routes found.\n";
+          } else {
+            std::cout << SerializeLaneSRoutes(result.routes, road_geometry) << "\n";
+          }
+        },
+        lane_graph, routing_mode, route_cache);
+  } catch (const std::exception& e) {
+    maliput::log()->error("{}", e.what());
+    return false;
+  }
+  std::cout << std::flush;
+  const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+  maliput::log()->info("Ran {} jobs ({} failed, {} without routes) in {} s.", num_jobs, num_failed_jobs,
+                       num_jobs_without_routes, duration.count());
+  if (route_cache != nullptr) {
+    const RouteCache::Statistics statistics = route_cache->statistics();
+    maliput::log()->info("Route cache: {} hits, {} misses, {} evictions, {} entries using {} bytes.", statistics.hits,
+                         statistics.misses, statistics.evictions, statistics.entries, statistics.memory_usage);
+  }
+  return true;
+}
+
 // Resolves the configuration parameters. Routing configuration can be loaded by using a configuration file or gflags.
 // @param[in] maliput_implementation Selected maliput backend.
 // @param[in] flag_config_file Configuration file path passed as gflags to the app.
@@ -192,7 +370,8 @@ std::string SerializeLaneSRoutes(const std::vector<LaneSRoute>& routes, const Ro
 // @param[in] flag_start_waypoint Start waypoint passed as gflags to the app.
 // @param[in] flag_end_waypoint End waypoint passed as gflags to the app.
 // @param[in] flag_max_length Max_length passed as gflags to the app.
-// @param[out] waypoints Start and end waypoints to be used.
+// @param[in] waypoints_required Whether waypoints must be provided. They are not when jobs come from a jobs file.
+// @param[out] waypoints Waypoints to be used, from start to end.
 // @param[out] max_length Max length to be used.
 // @param[out] xodr_file XODR file path to be used when using malidrive backend.
 // @param[out] yaml_file YAML file path to be used when using multilane backend.
@@ -200,8 +379,9 @@ std::string SerializeLaneSRoutes(const std::vector<LaneSRoute>& routes, const Ro
 bool ResolveConfigFields(const MaliputImplementation& maliput_implementation, const std::string& flag_config_file,
                          const std::string& flag_xodr_file_path, const std::string& flag_yaml_file,
                          const std::string& flag_start_waypoint, const std::string& flag_end_waypoint,
-                         const double flag_max_length, std::vector<maliput::math::Vector3>& waypoints,
-                         double& max_length, std::string& xodr_file, std::string& yaml_file) {
+                         const double flag_max_length, const bool waypoints_required,
+                         std::vector<maliput::math::Vector3>& waypoints, double& max_length, std::string& xodr_file,
+                         std::string& yaml_file) {
   // If configuration file is passed, check the YAML fields.
   if (!FLAGS_config_file.empty()) {
     maliput::log()->info("Configuration file is passed: {}", FLAGS_config_file);
@@ -212,6 +392,9 @@ bool ResolveConfigFields(const MaliputImplementation& maliput_implementation, co
     }
     for (const auto& key : {kXodrFileKey, kMaxLengthKey, kWaypointKey, kYamlFileKey}) {
       if (!root_node[key].IsDefined()) {
+        if (key == kWaypointKey && !waypoints_required) {
+          continue;
+        }
         if (key == kXodrFileKey && maliput_implementation != MaliputImplementation::kMalidrive) {
           continue;
         }
@@ -232,6 +415,9 @@ bool ResolveConfigFields(const MaliputImplementation& maliput_implementation, co
     max_length = root_node[kMaxLengthKey].as<double>();
 
     // Get waypoints from config file.
+    if (!waypoints_required) {
+      return true;
+    }
     const YAML::Node& waypoints_node = root_node[kWaypointKey];
     if (!waypoints_node.IsSequence()) {
       maliput::log()->error("Waypoints node is not a sequence.");
@@ -240,8 +426,8 @@ bool ResolveConfigFields(const MaliputImplementation& maliput_implementation, co
     for (const YAML::Node& waypoint_node : waypoints_node) {
       waypoints.push_back(waypoint_node.as<maliput::math::Vector3>());
     }
-    if (waypoints.size() != 2) {
-      maliput::log()->error("Currently, only two waypoints are supported.");
+    if (waypoints.size() < 2) {
+      maliput::log()->error("At least two waypoints are required.");
       return false;
     }
   } else {
@@ -267,6 +453,9 @@ bool ResolveConfigFields(const MaliputImplementation& maliput_implementation, co
     max_length = flag_max_length;
 
     // Get waypoints from flags.
+    if (!waypoints_required) {
+      return true;
+    }
     if (FLAGS_start_waypoint.empty()) {
       maliput::log()->error("'--start_waypoint; flag must be used when configuration file is missing.");
       return false;
@@ -296,15 +485,43 @@ int main(int argc, char* argv[]) {
   std::string yaml_file{""};
 
   if (!ResolveConfigFields(maliput_implementation, FLAGS_config_file, FLAGS_xodr_file_path, FLAGS_yaml_file,
-                           FLAGS_start_waypoint, FLAGS_end_waypoint, FLAGS_max_length, waypoints, max_length, xodr_file,
-                           yaml_file)) {
+                           FLAGS_start_waypoint, FLAGS_end_waypoint, FLAGS_max_length, FLAGS_jobs_file.empty(),
+                           waypoints, max_length, xodr_file, yaml_file)) {
     return 1;
   }
 
+  if (FLAGS_max_num_routes <= 0) {
+    maliput::log()->error("'--max_num_routes' must be positive.");
+    return 1;
+  }
+  if (FLAGS_num_routes <= 0) {
+    maliput::log()->error("'--num_routes' must be positive.");
+    return 1;
+  }
+  if (FLAGS_route_cache_mb < 0 || FLAGS_route_cache_s_bucket <= 0.) {
+    maliput::log()->error("'--route_cache_mb' must not be negative and '--route_cache_s_bucket' must be positive.");
+    return 1;
+  }
+  if (FLAGS_routing_mode != "all" && FLAGS_routing_mode != "shortest" && FLAGS_routing_mode != "k_shortest") {
+    maliput::log()->error("'--routing_mode' must be <all>, <shortest> or <k_shortest>.");
+    return 1;
+  }
+  // Cached legs are only ranked for the waypoints they were derived for, so the shortest routes would not be exact.
+  if (FLAGS_route_cache_mb > 0 && FLAGS_routing_mode != "all") {
+    maliput::log()->error("'--route_cache_mb' is only supported with '--routing_mode=all'.");
+    return 1;
+  }
+  const RoutingMode routing_mode = FLAGS_routing_mode == "all" ? RoutingMode::kAll : RoutingMode::kShortest;
+  const int max_num_routes = FLAGS_routing_mode == "all"        ? FLAGS_max_num_routes
+                             : FLAGS_routing_mode == "shortest" ? 1
+                                                                : FLAGS_num_routes;
+
   maliput::log()->info("Max length: {}", max_length);
-  maliput::log()->info("Waypoints:");
-  for (const auto& waypoint : waypoints) {
-    maliput::log()->info("  - {}", waypoint);
+  if (FLAGS_jobs_file.empty()) {
+    maliput::log()->info("Waypoints:");
+    for (const auto& waypoint : waypoints) {
+      maliput::log()->info("  - {}", waypoint);
+    }
   }
 
   maliput::log()->info("Loading road network using {} backend implementation...", FLAGS_maliput_backend);
@@ -328,9 +545,31 @@ int main(int argc, char* argv[]) {
   log()->info("RoadNetwork loaded successfully.");
 
   const RoadGeometry* road_geometry = rn->road_geometry();
+  std::unique_ptr<LaneGraph> lane_graph;
+  if (FLAGS_use_lane_graph || routing_mode == RoutingMode::kShortest) {
+    const auto start = std::chrono::steady_clock::now();
+    lane_graph = std::make_unique<LaneGraph>(road_geometry);
+    const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    maliput::log()->info("LaneGraph built: {} lanes, {} edges in {} s.", lane_graph->num_lanes(),
+                         lane_graph->num_edges(), duration.count());
+  }
+  std::unique_ptr<RouteCache> route_cache;
+  if (FLAGS_route_cache_mb > 0) {
+    route_cache = std::make_unique<RouteCache>(static_cast<std::size_t>(FLAGS_route_cache_mb) << 20,
+                                               FLAGS_route_cache_s_bucket);
+  }
+  if (!FLAGS_jobs_file.empty()) {
+    const bool succeeded = RunJobsFile(FLAGS_jobs_file, max_length, max_num_routes, routing_mode, road_geometry,
+                                       lane_graph.get(), route_cache.get());
+    return succeeded ? 0 : 1;
+  }
+  std::vector<InertialPosition> inertial_waypoints;
+  for (const maliput::math::Vector3& waypoint : waypoints) {
+    inertial_waypoints.push_back(InertialPosition::FromXyz(waypoint));
+  }
   const std::vector<LaneSRoute> routes =
-      GetRoutes(InertialPosition::FromXyz(waypoints.front()), InertialPosition::FromXyz(waypoints.back()), max_length,
-                road_geometry);
+      GetRoutes(inertial_waypoints, max_length, max_num_routes, routing_mode, road_geometry, lane_graph.get(),
+                route_cache.get());
 
   maliput::log()->info("Number of routes: {}", routes.size());
 
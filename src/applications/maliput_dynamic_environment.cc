@@ -58,6 +58,7 @@
 #include <maliput/common/logger.h>
 #include <maliput/common/maliput_abort.h>
 
+#include "integration/async_road_network_loader.h"
 #include "integration/create_dynamic_environment_handler.h"
 #include "integration/create_timer.h"
 #include "integration/dynamic_environment_handler.h"
@@ -81,6 +82,9 @@ namespace maliput {
 namespace integration {
 namespace {
 
+// Period in seconds to log the progress of the road network load.
+constexpr double kLoadProgressPeriod{1.};
+
 using maliput::api::rules::DiscreteValueRule;
 using maliput::api::rules::RangeValueRule;
 
@@ -170,20 +174,45 @@ int Main(int argc, char* argv[]) {
   common::set_log_level(FLAGS_log_level);
 
   log()->info("Loading road network using {} backend implementation...", FLAGS_maliput_backend);
-  const MaliputImplementation maliput_implementation{StringToMaliputImplementation(FLAGS_maliput_backend)};
-  auto rn = LoadRoadNetwork(
-      maliput_implementation,
-      {FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width, FLAGS_shoulder_width, FLAGS_maximum_height}, {FLAGS_yaml_file},
-      {FLAGS_xodr_file_path, GetLinearToleranceFlag(), GetMaxLinearToleranceFlag(), FLAGS_build_policy,
-       FLAGS_num_threads, FLAGS_simplification_policy, FLAGS_standard_strictness_policy, FLAGS_omit_nondrivable_lanes,
-       FLAGS_rule_registry_file, FLAGS_road_rule_book_file, FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file,
-       FLAGS_intersection_book_file},
-      {FLAGS_osm_file, FLAGS_linear_tolerance, FLAGS_angular_tolerance, maliput::math::Vector2::FromStr(FLAGS_origin),
-       FLAGS_rule_registry_file, FLAGS_road_rule_book_file, FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file,
-       FLAGS_intersection_book_file});
+  RoadNetworkDescriptor descriptor;
+  descriptor.maliput_implementation = StringToMaliputImplementation(FLAGS_maliput_backend);
+  descriptor.dragway_build_properties = {FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width, FLAGS_shoulder_width,
+                                         FLAGS_maximum_height};
+  descriptor.multilane_build_properties = {FLAGS_yaml_file};
+  descriptor.malidrive_build_properties = {FLAGS_xodr_file_path,
+                                           GetLinearToleranceFlag(),
+                                           GetMaxLinearToleranceFlag(),
+                                           FLAGS_build_policy,
+                                           FLAGS_num_threads,
+                                           FLAGS_simplification_policy,
+                                           FLAGS_standard_strictness_policy,
+                                           FLAGS_omit_nondrivable_lanes,
+                                           FLAGS_rule_registry_file,
+                                           FLAGS_road_rule_book_file,
+                                           FLAGS_traffic_light_book_file,
+                                           FLAGS_phase_ring_book_file,
+                                           FLAGS_intersection_book_file};
+  descriptor.maliput_osm_build_properties = {FLAGS_osm_file,
+                                             FLAGS_linear_tolerance,
+                                             FLAGS_angular_tolerance,
+                                             maliput::math::Vector2::FromStr(FLAGS_origin),
+                                             FLAGS_rule_registry_file,
+                                             FLAGS_road_rule_book_file,
+                                             FLAGS_traffic_light_book_file,
+                                             FLAGS_phase_ring_book_file,
+                                             FLAGS_intersection_book_file};
+  // The road network is built in the background; its progress is logged until it is ready.
+  AsyncRoadNetworkLoader loader(descriptor);
+  // Work that doesn't need the road network is done while it loads.
+  const std::unique_ptr<Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  while (!loader.WaitFor(kLoadProgressPeriod)) {
+    log()->info("Loading road network... {} s elapsed.", loader.elapsed());
+  }
+  auto rn = loader.Get();
   log()->info("RoadNetwork loaded successfully.");
 
-  const std::unique_ptr<const Timer> timer = CreateTimer(TimerType::kChronoTimer);
+  // The timeout is counted from the moment the road network is ready.
+  timer->Reset();
   const std::unique_ptr<DynamicEnvironmentHandler> deh = CreateDynamicEnvironmentHandler(
       DynamicEnvironmentHandlerType::kFixedPhaseIterationHandler, timer.get(), rn.get(), FLAGS_phase_duration);
 
@@ -30,7 +30,7 @@
 
 /// @file maliput_measure_load_time.cc
 ///
-/// Builds an api::RoadGeometry as many times as requested and calculates a mean with the time results. Possible
+/// Builds an api::RoadGeometry as many times as requested and computes statistics of the time results. Possible
 /// backends are `dragway`, `multilane` and `malidrive`.
 ///
 /// @note
@@ -42,22 +42,95 @@
 ///           -yaml_file.
 ///      - "malidrive": xodr file path must be provided and other arguments are optional:
 ///           -xodr_file_path -linear_tolerance -build_policy -num_threads.
-///   2. The applications allows you to load a xodr multiple times and calculate a mean.
-///      The number of iterations could be changed using:
+///      The rule registry and the books of the `malidrive` and `osm` backends could be skipped to measure
+///      geometry-only workflows with: -geometry_only.
+///   2. The applications allows you to load a xodr multiple times and compute statistics of the load time:
+///      min, max, mean, median, p90, p99, standard deviation and the 95% confidence interval of the mean.
+///      The number of measured iterations could be changed using:
 ///      -iterations
-///   3. The level of the logger is selected with `-log_level`.
+///      Iterations that are run beforehand and discarded could be added using:
+///      -warmup_iterations
+///   3. Results could be exported in a machine readable format:
+///      -output_format: `text`, `json` or `csv`.
+///      -output_file: File to write the results to. When empty, the standard output is used.
+///   4. A breakdown of the time spent in each phase of the load process (resource resolution, backend build, etc.)
+///      accumulated over all the measured iterations could be enabled with:
+///      -phase_breakdown
+///      It is printed as a tree for the `text` output format and included in the `json` output format.
+///   5. The scaling of a parallel `malidrive` build with the number of threads could be measured with:
+///      -thread_sweep
+///      The map is loaded with the `sequential` build policy and then with the `parallel` build policy using from 1 to
+///      `-max_threads` threads. Each configuration is loaded `-iterations` times (after `-warmup_iterations`) and its
+///      median load time is used to compute the speedup and efficiency relative to the sequential load, as well as the
+///      knee of the speedup curve: the number of threads beyond which adding threads yields diminishing returns.
+///   6. Memory usage of each load is reported along with the load time: peak resident set size of the process, growth
+///      of the resident set size, number and bytes of heap allocations, peak of the heap usage and heap bytes retained
+///      by the built api::RoadNetwork. The maximum over the measured iterations is reported. Heap allocations are
+///      accounted by replacing the global `operator new` and `operator delete` of this executable.
+///   7. The level of the logger is selected with `-log_level`.
 
+#include <algorithm>
 #include <chrono>
-#include <numeric>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gflags/gflags.h>
 #include <maliput/common/logger.h>
+#include <malloc.h>
 
+#include "integration/json_writer.h"
+#include "integration/memory_usage.h"
+#include "integration/phase_profiler.h"
+#include "integration/scaling.h"
+#include "integration/statistics.h"
 #include "integration/tools.h"
 #include "maliput_gflags.h"
 
+// Replacements of the global allocation functions so that the heap allocations are accounted by
+// maliput::integration::AllocationTracker. Sizes are obtained with malloc_usable_size() so that allocations and
+// deallocations match even when the unsized operator delete is called.
+void* operator new(std::size_t size) {
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  maliput::integration::AllocationTracker::RecordAllocation(malloc_usable_size(ptr));
+  return ptr;
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return operator new(size);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return operator new(size, std::nothrow); }
+
+void operator delete(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  maliput::integration::AllocationTracker::RecordDeallocation(malloc_usable_size(ptr));
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { operator delete(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { operator delete(ptr); }
+
 namespace maliput {
 namespace integration {
 namespace {
@@ -72,28 +145,308 @@ MALIPUT_APPLICATION_DEFINE_LOG_LEVEL_FLAG();
 DEFINE_string(maliput_backend, "malidrive",
               "Whether to use <dragway>, <multilane> or <malidrive>. Default is malidrive.");
 DEFINE_int32(iterations, 1, "Number of iterations for loading the Road Geometry.");
+DEFINE_int32(warmup_iterations, 0, "Number of iterations to run and discard before the measured ones.");
+DEFINE_string(output_format, "text", "Format of the results: <text>, <json> or <csv>.");
+DEFINE_string(output_file, "", "File to write the results to. When empty, results are written to the standard output.");
+DEFINE_bool(phase_breakdown, false, "Whether to report the time spent in each phase of the load process.");
+DEFINE_bool(geometry_only, false,
+            "Whether to skip loading the rule registry and the books of the malidrive and osm backends.");
+DEFINE_bool(thread_sweep, false,
+            "Whether to measure how a parallel malidrive load scales with the number of threads. Only supported by the "
+            "malidrive backend.");
+DEFINE_int32(max_threads, 0,
+             "Maximum number of threads used by -thread_sweep. When zero, the number of hardware threads is used.");
+
+// Memory usage of a road network load.
+struct MemoryUsage {
+  // Peak resident set size of the process during the load, in bytes.
+  std::int64_t peak_resident_memory{0};
+  // Growth of the resident set size of the process, in bytes.
+  std::int64_t resident_memory_growth{0};
+  // Number of heap allocations.
+  std::int64_t allocation_count{0};
+  // Bytes of the heap allocations.
+  std::int64_t allocated_bytes{0};
+  // Peak of the heap usage over the heap usage before the load, in bytes.
+  std::int64_t peak_heap_bytes{0};
+  // Heap bytes still allocated once the road network is built.
+  std::int64_t retained_heap_bytes{0};
+};
 
-// Measure the time that it takes to create the RoadNetwork using the implementation that `maliput_implementation`
-// describes. It is a wrapper around maliput::integration::LoadRoadNetwork() method.
+// Time and memory usage of a road network load.
+struct LoadMeasurement {
+  // Load time in seconds.
+  double time{0.};
+  MemoryUsage memory;
+};
+
+// Measure the time and memory that it takes to create the RoadNetwork using the implementation that
+// `maliput_implementation` describes. It is a wrapper around maliput::integration::LoadRoadNetwork() method.
 //
-// @param maliput_implementation One of MaliputImplementation. (kDragway, kMultilane, kMalidrive).
+// @param maliput_implementation One of MaliputImplementation. (kDragway, kMultilane, kMalidrive, kMaliputOsm).
 // @param dragway_build_properties Holds the properties to build a dragway RoadNetwork.
 // @param multilane_build_properties Holds the properties to build a multilane RoadNetwork.
 // @param malidrive_build_properties Holds the properties to build a malidrive RoadNetwork.
-// @return the time in seconds.
+// @param maliput_osm_build_properties Holds the properties to build a maliput_osm RoadNetwork.
+// @param profiler Optional PhaseProfiler to record the building phases into. It could be nullptr.
+// @return the load time in seconds and the memory usage of the load.
 //
 // @throw maliput::common::assertion_error When `maliput_implementation` is unknown.
-double MeasureLoadTime(MaliputImplementation maliput_implementation,
-                       const DragwayBuildProperties& dragway_build_properties,
-                       const MultilaneBuildProperties& multilane_build_properties,
-                       const MalidriveBuildProperties& malidrive_build_properties,
-                       const MaliputOsmBuildProperties& maliput_osm_build_properties) {
+LoadMeasurement MeasureLoadTime(MaliputImplementation maliput_implementation,
+                                const DragwayBuildProperties& dragway_build_properties,
+                                const MultilaneBuildProperties& multilane_build_properties,
+                                const MalidriveBuildProperties& malidrive_build_properties,
+                                const MaliputOsmBuildProperties& maliput_osm_build_properties,
+                                PhaseProfiler* profiler = nullptr) {
+  ResetPeakResidentMemory();
+  const std::int64_t start_resident_memory = GetCurrentResidentMemory();
+  AllocationTracker::ResetPeak();
+  const AllocationStats start_allocations = AllocationTracker::Snapshot();
+
   const auto start = std::chrono::high_resolution_clock::now();
   const auto rn = LoadRoadNetwork(maliput_implementation, dragway_build_properties, multilane_build_properties,
-                                  malidrive_build_properties, maliput_osm_build_properties);
+                                  malidrive_build_properties, maliput_osm_build_properties, profiler);
   const auto end = std::chrono::high_resolution_clock::now();
+
+  const AllocationStats allocations = AllocationTracker::Snapshot() - start_allocations;
+  const std::int64_t end_resident_memory = GetCurrentResidentMemory();
   const std::chrono::duration<double> duration = (end - start);
-  return duration.count();
+
+  LoadMeasurement measurement;
+  measurement.time = duration.count();
+  measurement.memory.peak_resident_memory = GetPeakResidentMemory();
+  measurement.memory.resident_memory_growth = end_resident_memory - start_resident_memory;
+  measurement.memory.allocation_count = allocations.count;
+  measurement.memory.allocated_bytes = allocations.bytes;
+  measurement.memory.peak_heap_bytes = allocations.peak_live_bytes;
+  measurement.memory.retained_heap_bytes =
+      static_cast<std::int64_t>(allocations.bytes) - static_cast<std::int64_t>(allocations.free_bytes);
+  return measurement;
+}
+
+// @returns The load times of @p measurements.
+std::vector<double> Times(const std::vector<LoadMeasurement>& measurements) {
+  std::vector<double> times;
+  times.reserve(measurements.size());
+  for (const LoadMeasurement& measurement : measurements) {
+    times.push_back(measurement.time);
+  }
+  return times;
+}
+
+// @returns The element-wise maximum of the memory usage of @p measurements.
+MemoryUsage MaxMemoryUsage(const std::vector<LoadMeasurement>& measurements) {
+  MemoryUsage max_memory_usage{measurements.front().memory};
+  for (const LoadMeasurement& measurement : measurements) {
+    const MemoryUsage& memory = measurement.memory;
+    max_memory_usage.peak_resident_memory =
+        std::max(max_memory_usage.peak_resident_memory, memory.peak_resident_memory);
+    max_memory_usage.resident_memory_growth =
+        std::max(max_memory_usage.resident_memory_growth, memory.resident_memory_growth);
+    max_memory_usage.allocation_count = std::max(max_memory_usage.allocation_count, memory.allocation_count);
+    max_memory_usage.allocated_bytes = std::max(max_memory_usage.allocated_bytes, memory.allocated_bytes);
+    max_memory_usage.peak_heap_bytes = std::max(max_memory_usage.peak_heap_bytes, memory.peak_heap_bytes);
+    max_memory_usage.retained_heap_bytes = std::max(max_memory_usage.retained_heap_bytes, memory.retained_heap_bytes);
+  }
+  return max_memory_usage;
+}
+
+// Loads the road network FLAGS_warmup_iterations times discarding the results and then FLAGS_iterations times.
+// @p description is used for logging purposes.
+// @returns The measurements of the measured iterations.
+std::vector<LoadMeasurement> MeasureLoads(const std::string& description, MaliputImplementation maliput_implementation,
+                                          const DragwayBuildProperties& dragway_build_properties,
+                                          const MultilaneBuildProperties& multilane_build_properties,
+                                          const MalidriveBuildProperties& malidrive_build_properties,
+                                          const MaliputOsmBuildProperties& maliput_osm_build_properties,
+                                          PhaseProfiler* profiler = nullptr) {
+  for (int i = 0; i < FLAGS_warmup_iterations; i++) {
+    log()->info("Building RoadNetwork{} (warmup) {} of {}.", description, i + 1, FLAGS_warmup_iterations);
+    MeasureLoadTime(maliput_implementation, dragway_build_properties, multilane_build_properties,
+                    malidrive_build_properties, maliput_osm_build_properties);
+  }
+  std::vector<LoadMeasurement> measurements;
+  measurements.reserve(FLAGS_iterations);
+  for (int i = 0; i < FLAGS_iterations; i++) {
+    log()->info("Building RoadNetwork{} {} of {}.", description, i + 1, FLAGS_iterations);
+    measurements.push_back(MeasureLoadTime(maliput_implementation, dragway_build_properties,
+                                           multilane_build_properties, malidrive_build_properties,
+                                           maliput_osm_build_properties, profiler));
+  }
+  return measurements;
+}
+
+// Writes @p statistics of the load times and the @p memory usage in a human readable format into @p out.
+// When @p profiler is not nullptr, the phase breakdown is written too.
+void WriteText(const SampleStatistics& statistics, const MemoryUsage& memory, const PhaseProfiler* profiler,
+               std::ostream* out) {
+  (*out) << "Load time statistics out of " << statistics.count << " iterations:" << std::endl;
+  (*out) << "\tmin:    " << statistics.min << " s" << std::endl;
+  (*out) << "\tmax:    " << statistics.max << " s" << std::endl;
+  (*out) << "\tmean:   " << statistics.mean << " s" << std::endl;
+  (*out) << "\tmedian: " << statistics.median << " s" << std::endl;
+  (*out) << "\tp90:    " << statistics.p90 << " s" << std::endl;
+  (*out) << "\tp99:    " << statistics.p99 << " s" << std::endl;
+  (*out) << "\tstddev: " << statistics.stddev << " s" << std::endl;
+  (*out) << "\t95% CI: [" << statistics.ci95_low << ", " << statistics.ci95_high << "] s" << std::endl;
+  (*out) << "Memory usage (maximum out of " << statistics.count << " iterations):" << std::endl;
+  (*out) << "\tpeak RSS:          " << memory.peak_resident_memory << " B" << std::endl;
+  (*out) << "\tRSS growth:        " << memory.resident_memory_growth << " B" << std::endl;
+  (*out) << "\theap allocations:  " << memory.allocation_count << std::endl;
+  (*out) << "\tallocated bytes:   " << memory.allocated_bytes << " B" << std::endl;
+  (*out) << "\tpeak heap usage:   " << memory.peak_heap_bytes << " B" << std::endl;
+  (*out) << "\tretained heap:     " << memory.retained_heap_bytes << " B" << std::endl;
+  if (profiler != nullptr) {
+    (*out) << "Load phases accumulated over " << statistics.count << " iterations:" << std::endl;
+    profiler->Print(out);
+  }
+}
+
+// Writes @p statistics of the load times, the raw @p times and the @p memory usage as a JSON object into @p writer.
+// When @p profiler is not nullptr, the phase breakdown is written too.
+void WriteJson(const SampleStatistics& statistics, const std::vector<double>& times, const MemoryUsage& memory,
+               const PhaseProfiler* profiler, JsonWriter* writer) {
+  writer->StartObject();
+  writer->Key("maliput_backend").Value(FLAGS_maliput_backend);
+  writer->Key("iterations").Value(statistics.count);
+  writer->Key("warmup_iterations").Value(FLAGS_warmup_iterations);
+  writer->Key("unit").Value("s");
+  writer->Key("statistics").StartObject();
+  writer->Key("min").Value(statistics.min);
+  writer->Key("max").Value(statistics.max);
+  writer->Key("mean").Value(statistics.mean);
+  writer->Key("median").Value(statistics.median);
+  writer->Key("p90").Value(statistics.p90);
+  writer->Key("p99").Value(statistics.p99);
+  writer->Key("stddev").Value(statistics.stddev);
+  writer->Key("ci95_low").Value(statistics.ci95_low);
+  writer->Key("ci95_high").Value(statistics.ci95_high);
+  writer->EndObject();
+  writer->Key("samples").StartArray();
+  for (const double time : times) {
+    writer->Value(time);
+  }
+  writer->EndArray();
+  writer->Key("memory").StartObject();
+  writer->Key("unit").Value("B");
+  writer->Key("peak_resident_memory").Value(memory.peak_resident_memory);
+  writer->Key("resident_memory_growth").Value(memory.resident_memory_growth);
+  writer->Key("allocation_count").Value(memory.allocation_count);
+  writer->Key("allocated_bytes").Value(memory.allocated_bytes);
+  writer->Key("peak_heap_bytes").Value(memory.peak_heap_bytes);
+  writer->Key("retained_heap_bytes").Value(memory.retained_heap_bytes);
+  writer->EndObject();
+  if (profiler != nullptr) {
+    writer->Key("phases");
+    profiler->WriteJson(writer);
+  }
+  writer->EndObject();
+}
+
+// Writes @p statistics of the load times and the @p memory usage as a CSV header and row into @p out.
+void WriteCsv(const SampleStatistics& statistics, const MemoryUsage& memory, std::ostream* out) {
+  (*out) << "maliput_backend,iterations,warmup_iterations,min,max,mean,median,p90,p99,stddev,ci95_low,ci95_high,"
+            "peak_resident_memory,resident_memory_growth,allocation_count,allocated_bytes,peak_heap_bytes,"
+            "retained_heap_bytes"
+         << std::endl;
+  (*out) << FLAGS_maliput_backend << "," << statistics.count << "," << FLAGS_warmup_iterations << ","
+         << statistics.min << "," << statistics.max << "," << statistics.mean << "," << statistics.median << ","
+         << statistics.p90 << "," << statistics.p99 << "," << statistics.stddev << "," << statistics.ci95_low << ","
+         << statistics.ci95_high << "," << memory.peak_resident_memory << "," << memory.resident_memory_growth << ","
+         << memory.allocation_count << "," << memory.allocated_bytes << "," << memory.peak_heap_bytes << ","
+         << memory.retained_heap_bytes << std::endl;
+}
+
+// Writes the thread sweep @p report in a human readable format into @p out.
+void WriteThreadSweepText(const ScalingReport& report, std::ostream* out) {
+  (*out) << "Thread sweep out of " << FLAGS_iterations << " iterations per configuration (median load times):"
+         << std::endl;
+  (*out) << "\tbuild_policy\tthreads\ttime [s]\tspeedup\tefficiency" << std::endl;
+  (*out) << "\tsequential\t-\t" << report.baseline_time << "\t1\t-" << std::endl;
+  for (const ScalingPoint& point : report.points) {
+    (*out) << "\tparallel\t" << point.num_threads << "\t" << point.time << "\t" << point.speedup << "\t"
+           << point.efficiency << std::endl;
+  }
+  (*out) << "Knee at " << report.points[report.knee_index].num_threads << " threads." << std::endl;
+}
+
+// Writes the thread sweep @p report and the @p statistics of each configuration as a JSON object into @p writer.
+// @p statistics holds the sequential configuration first followed by one entry per point in @p report.
+void WriteThreadSweepJson(const ScalingReport& report, const std::vector<SampleStatistics>& statistics,
+                          JsonWriter* writer) {
+  const auto write_statistics = [writer](const SampleStatistics& s) {
+    writer->Key("statistics").StartObject();
+    writer->Key("min").Value(s.min);
+    writer->Key("max").Value(s.max);
+    writer->Key("mean").Value(s.mean);
+    writer->Key("median").Value(s.median);
+    writer->Key("stddev").Value(s.stddev);
+    writer->EndObject();
+  };
+  writer->StartObject();
+  writer->Key("maliput_backend").Value(FLAGS_maliput_backend);
+  writer->Key("iterations").Value(FLAGS_iterations);
+  writer->Key("warmup_iterations").Value(FLAGS_warmup_iterations);
+  writer->Key("unit").Value("s");
+  writer->Key("sequential").StartObject();
+  writer->Key("time").Value(report.baseline_time);
+  write_statistics(statistics[0]);
+  writer->EndObject();
+  writer->Key("parallel").StartArray();
+  for (std::size_t i = 0; i < report.points.size(); ++i) {
+    writer->StartObject();
+    writer->Key("num_threads").Value(report.points[i].num_threads);
+    writer->Key("time").Value(report.points[i].time);
+    writer->Key("speedup").Value(report.points[i].speedup);
+    writer->Key("efficiency").Value(report.points[i].efficiency);
+    write_statistics(statistics[i + 1]);
+    writer->EndObject();
+  }
+  writer->EndArray();
+  writer->Key("knee_num_threads").Value(report.points[report.knee_index].num_threads);
+  writer->EndObject();
+}
+
+// Writes the thread sweep @p report as a CSV header and one row per configuration into @p out.
+void WriteThreadSweepCsv(const ScalingReport& report, std::ostream* out) {
+  (*out) << "build_policy,num_threads,time,speedup,efficiency,knee" << std::endl;
+  (*out) << "sequential,," << report.baseline_time << ",1,," << std::endl;
+  for (int i = 0; i < static_cast<int>(report.points.size()); ++i) {
+    const ScalingPoint& point = report.points[i];
+    (*out) << "parallel," << point.num_threads << "," << point.time << "," << point.speedup << "," << point.efficiency
+           << "," << (i == report.knee_index ? "true" : "false") << std::endl;
+  }
+}
+
+// Loads the malidrive road network described by @p malidrive_build_properties with the `sequential` build policy and
+// then with the `parallel` build policy using from 1 to @p max_threads threads.
+// @returns The ScalingReport of the sweep. @p statistics is filled with the statistics of the sequential
+// configuration followed by one entry per number of threads.
+ScalingReport RunThreadSweep(const MalidriveBuildProperties& malidrive_build_properties, int max_threads,
+                             std::vector<SampleStatistics>* statistics) {
+  const DragwayBuildProperties dragway_build_properties{};
+  const MultilaneBuildProperties multilane_build_properties{};
+  const MaliputOsmBuildProperties maliput_osm_build_properties{};
+
+  MalidriveBuildProperties sweep_build_properties{malidrive_build_properties};
+  sweep_build_properties.build_policy = "sequential";
+  sweep_build_properties.number_of_threads = 0;
+  statistics->push_back(ComputeSampleStatistics(
+      Times(MeasureLoads(" (sequential)", MaliputImplementation::kMalidrive, dragway_build_properties,
+                         multilane_build_properties, sweep_build_properties, maliput_osm_build_properties))));
+
+  std::vector<int> num_threads;
+  std::vector<double> times;
+  sweep_build_properties.build_policy = "parallel";
+  for (int threads = 1; threads <= max_threads; ++threads) {
+    sweep_build_properties.number_of_threads = threads;
+    statistics->push_back(ComputeSampleStatistics(Times(MeasureLoads(
+        " (parallel, " + std::to_string(threads) + " threads)", MaliputImplementation::kMalidrive,
+        dragway_build_properties, multilane_build_properties, sweep_build_properties, maliput_osm_build_properties))));
+    num_threads.push_back(threads);
+    times.push_back(statistics->back().median);
+  }
+  return ComputeScalingReport(statistics->front().median, num_threads, times);
 }
 
 int Main(int argc, char* argv[]) {
@@ -107,24 +460,104 @@ int Main(int argc, char* argv[]) {
     log()->error("Iterations: {}. The number of iterations must be greater than zero.", FLAGS_iterations);
     return 1;
   }
-  std::vector<double> times;
-  times.reserve(FLAGS_iterations);
-  for (int i = 0; i < FLAGS_iterations; i++) {
-    log()->info("Building RoadNetwork {} of {}.", i + 1, FLAGS_iterations);
-    times.push_back(MeasureLoadTime(
-        maliput_implementation,
-        {FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width, FLAGS_shoulder_width, FLAGS_maximum_height},
-        {FLAGS_yaml_file},
-        {FLAGS_xodr_file_path, GetLinearToleranceFlag(), GetMaxLinearToleranceFlag(), FLAGS_build_policy,
-         FLAGS_num_threads, FLAGS_simplification_policy, FLAGS_standard_strictness_policy, FLAGS_omit_nondrivable_lanes,
-         FLAGS_rule_registry_file, FLAGS_road_rule_book_file, FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file,
-         FLAGS_intersection_book_file},
-        {FLAGS_osm_file, FLAGS_linear_tolerance, FLAGS_angular_tolerance, maliput::math::Vector2::FromStr(FLAGS_origin),
-         FLAGS_rule_registry_file, FLAGS_road_rule_book_file, FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file,
-         FLAGS_intersection_book_file}));
-  }
-  const double mean_time = (std::accumulate(times.begin(), times.end(), 0.)) / static_cast<double>(times.size());
-  maliput::log()->info("\tMean time was: {}s out of {} iterations.\n", mean_time, FLAGS_iterations);
+  if (FLAGS_warmup_iterations < 0) {
+    log()->error("Warmup iterations: {}. The number of warmup iterations must not be negative.",
+                 FLAGS_warmup_iterations);
+    return 1;
+  }
+  if (FLAGS_output_format != "text" && FLAGS_output_format != "json" && FLAGS_output_format != "csv") {
+    log()->error("Output format: {}. It must be one of <text>, <json> or <csv>.", FLAGS_output_format);
+    return 1;
+  }
+  if (FLAGS_thread_sweep && maliput_implementation != MaliputImplementation::kMalidrive) {
+    log()->error("Thread sweep is only supported by the malidrive backend.");
+    return 1;
+  }
+  if (FLAGS_max_threads < 0) {
+    log()->error("Max threads: {}. The maximum number of threads must not be negative.", FLAGS_max_threads);
+    return 1;
+  }
+
+  const DragwayBuildProperties dragway_build_properties{FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width,
+                                                        FLAGS_shoulder_width, FLAGS_maximum_height};
+  const MultilaneBuildProperties multilane_build_properties{FLAGS_yaml_file};
+  const MalidriveBuildProperties malidrive_build_properties{FLAGS_xodr_file_path,
+                                                            GetLinearToleranceFlag(),
+                                                            GetMaxLinearToleranceFlag(),
+                                                            FLAGS_build_policy,
+                                                            FLAGS_num_threads,
+                                                            FLAGS_simplification_policy,
+                                                            FLAGS_standard_strictness_policy,
+                                                            FLAGS_omit_nondrivable_lanes,
+                                                            FLAGS_rule_registry_file,
+                                                            FLAGS_road_rule_book_file,
+                                                            FLAGS_traffic_light_book_file,
+                                                            FLAGS_phase_ring_book_file,
+                                                            FLAGS_intersection_book_file,
+                                                            FLAGS_geometry_only};
+  const MaliputOsmBuildProperties maliput_osm_build_properties{FLAGS_osm_file,
+                                                               FLAGS_linear_tolerance,
+                                                               FLAGS_angular_tolerance,
+                                                               maliput::math::Vector2::FromStr(FLAGS_origin),
+                                                               FLAGS_rule_registry_file,
+                                                               FLAGS_road_rule_book_file,
+                                                               FLAGS_traffic_light_book_file,
+                                                               FLAGS_phase_ring_book_file,
+                                                               FLAGS_intersection_book_file,
+                                                               FLAGS_geometry_only};
+
+  std::ofstream output_file;
+  if (!FLAGS_output_file.empty()) {
+    output_file.open(FLAGS_output_file);
+    if (!output_file.is_open()) {
+      log()->error("Output file: {} could not be opened.", FLAGS_output_file);
+      return 1;
+    }
+  }
+  std::ostream* out = FLAGS_output_file.empty() ? &std::cout : &output_file;
+
+  if (FLAGS_thread_sweep) {
+    if (FLAGS_phase_breakdown) {
+      log()->warn("Phase breakdown is not supported by the thread sweep.");
+    }
+    const int max_threads =
+        FLAGS_max_threads > 0 ? FLAGS_max_threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::vector<SampleStatistics> sweep_statistics;
+    const ScalingReport report = RunThreadSweep(malidrive_build_properties, max_threads, &sweep_statistics);
+    if (FLAGS_output_format == "json") {
+      JsonWriter writer(out);
+      WriteThreadSweepJson(report, sweep_statistics, &writer);
+      (*out) << std::endl;
+    } else if (FLAGS_output_format == "csv") {
+      WriteThreadSweepCsv(report, out);
+    } else {
+      WriteThreadSweepText(report, out);
+    }
+    return 0;
+  }
+
+  PhaseProfiler phase_profiler;
+  PhaseProfiler* profiler = FLAGS_phase_breakdown ? &phase_profiler : nullptr;
+  const std::vector<LoadMeasurement> measurements =
+      MeasureLoads("", maliput_implementation, dragway_build_properties, multilane_build_properties,
+                   malidrive_build_properties, maliput_osm_build_properties, profiler);
+  const std::vector<double> times = Times(measurements);
+  const SampleStatistics statistics = ComputeSampleStatistics(times);
+  const MemoryUsage memory = MaxMemoryUsage(measurements);
+  maliput::log()->info("\tMean time was: {}s out of {} iterations.\n", statistics.mean, FLAGS_iterations);
+
+  if (FLAGS_output_format == "json") {
+    JsonWriter writer(out);
+    WriteJson(statistics, times, memory, profiler, &writer);
+    (*out) << std::endl;
+  } else if (FLAGS_output_format == "csv") {
+    if (profiler != nullptr) {
+      log()->warn("Phase breakdown is not supported by the csv output format.");
+    }
+    WriteCsv(statistics, memory, out);
+  } else {
+    WriteText(statistics, memory, profiler, out);
+  }
 
   return 0;
 }
@@ -43,8 +43,20 @@
 ///         -xodr_file_path -linear_tolerance -road_rule_book_file -traffic_light_book_file -phase_ring_book_file
 ///         -intersection_book_file
 /// 2. The level of the logger could be setted by: -log_level.
+/// 3. Several commands could be run against the same road network by providing them, one per line, in the file
+///    given by -commands_file. Use `-` to read them from the standard input.
+/// 4. A spatial index of the lanes could be built to speed up FindRoadPositions and FindOverlappingLanesIn:
+///    -spatial_index. FindOverlappingLanesIn then classifies the lanes the index keeps with the test
+///    -overlapping_threads uses. Use -spatial_index_compare to also time the queries without pruning the lanes.
+/// 5. FindOverlappingLanesIn could classify the lanes concurrently: -overlapping_threads.
+/// 6. The latency of every query is recorded in a histogram per command. Histograms could be written as JSON to the
+///    file given by -latency_json; they are also summarized at the end of the batch mode.
+/// 7. Results could be written as JSON, one object per query and line, instead of text: -output_format=json.
 
 #include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -57,6 +69,8 @@
 #include <gflags/gflags.h>
 #include <maliput/common/logger.h>
 #include <maliput/common/maliput_abort.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/common/maliput_throw.h>
 #include <maliput/math/bounding_box.h>
 #include <maliput/math/overlapping_type.h>
 #include <maliput/plugin/create_road_network.h>
@@ -67,6 +81,15 @@
 #include <maliput_object/base/manual_object_book.h>
 #include <maliput_object/base/simple_object_query.h>
 
+#include "integration/async_road_network_loader.h"
+#include "integration/json_serialization.h"
+#include "integration/json_writer.h"
+#include "integration/lane_rule_index.h"
+#include "integration/lane_spatial_index.h"
+#include "integration/latency_histogram.h"
+#include "integration/overlapping_lanes.h"
+#include "integration/road_position_batch.h"
+#include "integration/thread_pool.h"
 #include "integration/tools.h"
 #include "maliput_gflags.h"
 
@@ -78,11 +101,31 @@ MALIPUT_OSM_PROPERTIES_FLAGS();
 MALIPUT_APPLICATION_DEFINE_LOG_LEVEL_FLAG();
 
 DEFINE_string(maliput_backend, "malidrive", "Whether to use <dragway>, <multilane> or <malidrive> maliput backend.");
+DEFINE_string(commands_file, "",
+              "File to read commands from, one per line, to run them against the same road network. Use '-' to read "
+              "them from the standard input.");
+DEFINE_bool(spatial_index, false,
+            "Whether to build a spatial index of the lanes to speed up FindRoadPositions and FindOverlappingLanesIn.");
+DEFINE_bool(spatial_index_compare, false,
+            "Whether to run FindRoadPositions and FindOverlappingLanesIn both with and without the spatial index and "
+            "print both query times. It implies --spatial_index.");
+DEFINE_string(latency_json, "",
+              "File to write the latency histograms of the queries to, as JSON. Nothing is written when empty.");
+DEFINE_int32(overlapping_threads, 0,
+             "Number of threads FindOverlappingLanesIn classifies the lanes on, by splitting them in pieces. When 0, "
+             "maliput object's SimpleObjectQuery is used instead.");
+DEFINE_string(output_format, "text",
+              "Format of the query results: <text>, human readable, or <json>, one JSON object per query and line.");
 
 namespace maliput {
 namespace integration {
 namespace {
 
+// Period in seconds to log the progress of the road network load.
+constexpr double kLoadProgressPeriod{1.};
+// Maximum length of the lane pieces FindOverlappingLanesIn checks when running concurrently.
+constexpr double kOverlappingSamplingStep{0.5};
+
 void GetMaliputBackendList(std::ostream* out) {
   maliput::plugin::MaliputPluginManager manager;
   const auto plugins = manager.ListPlugins();
@@ -142,6 +185,15 @@ const std::map<const std::string, const Command> CommandsUsage() {
         {"Obtains the RoadPosition of the point in the RoadGeometry manifold",
          "which is, in the world frame, closest to an (x, y, z) InertialPosition."},
         4}},
+      {"ToRoadPositionBatch",
+       {"ToRoadPositionBatch",
+        "ToRoadPositionBatch file_path",
+        {"Obtains the RoadPosition, as ToRoadPosition does, of every (x, y, z)",
+         "InertialPosition in file_path. Positions are projected concurrently.",
+         "Files with .bin extension hold packed native-endian doubles as x, y, z",
+         "triplets; other files are read as CSV, one x,y,z position per line.",
+         "Results are printed as CSV: x,y,z,lane_id,s,r,h,distance."},
+        2}},
       {"ToLanePosition",
        {"ToLanePosition",
         "ToLanePosition lane_id x y z",
@@ -347,6 +399,7 @@ std::string GetUsageMessage() {
   std::stringstream ss;
   ss << "CLI for easy Malidrive road networks querying" << std::endl << std::endl;
   ss << "  maliput_query -- <command> <arg1> <arg2> ... <argN> " << std::endl << std::endl;
+  ss << "  maliput_query --commands_file=<file> " << std::endl << std::endl;
   ss << "  Supported commands:" << std::endl;
   const std::map<const std::string, const Command> command_usage = CommandsUsage();
   for (auto it = command_usage.begin(); it != command_usage.end(); ++it) {
@@ -361,12 +414,76 @@ std::string GetUsageMessage() {
      << std::endl;
   ss << "    $ maliput_query --maliput_backend=malidrive --xodr_file_path=TShapeRoad.xodr -- ToRoadPosition 0.0 -1.5 "
         "2.0"
+     << std::endl;
+  ss << "    $ maliput_query --maliput_backend=malidrive --xodr_file_path=TShapeRoad.xodr --commands_file=commands.txt"
      << std::endl
      << std::endl;
 
   return ss.str();
 }
 
+/// Reads the InertialPositions in `file_path` as a structure of arrays.
+///
+/// Files with `.bin` extension hold packed native-endian doubles as x, y, z triplets. Other files are read as CSV with
+/// one `x,y,z` position per line; empty lines and lines starting with `#` are skipped.
+///
+/// @param file_path Path to the file.
+/// @param x, y, z Arrays the coordinates are appended to. They must not be nullptr.
+/// @throws std::runtime_error When the file can't be read or holds malformed positions.
+void ReadInertialPositions(const std::string& file_path, std::vector<double>* x, std::vector<double>* y,
+                           std::vector<double>* z) {
+  MALIPUT_THROW_UNLESS(x != nullptr);
+  MALIPUT_THROW_UNLESS(y != nullptr);
+  MALIPUT_THROW_UNLESS(z != nullptr);
+  static constexpr char kBinaryExtension[]{".bin"};
+  const bool is_binary = file_path.size() >= sizeof(kBinaryExtension) - 1 &&
+                         file_path.compare(file_path.size() - (sizeof(kBinaryExtension) - 1),
+                                           sizeof(kBinaryExtension) - 1, kBinaryExtension) == 0;
+  std::ifstream file(file_path, is_binary ? std::ios::binary : std::ios::in);
+  if (!file.is_open()) {
+    MALIPUT_THROW_MESSAGE("Positions file: " + file_path + " could not be opened.");
+  }
+  if (is_binary) {
+    file.seekg(0, std::ios::end);
+    const std::streamoff file_size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    constexpr std::streamoff kPositionSize = 3 * sizeof(double);
+    if (file_size % kPositionSize != 0) {
+      MALIPUT_THROW_MESSAGE("Positions file: " + file_path + " size is not a multiple of 3 doubles.");
+    }
+    const std::size_t num_positions = static_cast<std::size_t>(file_size / kPositionSize);
+    std::vector<double> xyz(3 * num_positions);
+    file.read(reinterpret_cast<char*>(xyz.data()), file_size);
+    x->reserve(x->size() + num_positions);
+    y->reserve(y->size() + num_positions);
+    z->reserve(z->size() + num_positions);
+    for (std::size_t i = 0; i < num_positions; ++i) {
+      x->push_back(xyz[3 * i]);
+      y->push_back(xyz[3 * i + 1]);
+      z->push_back(xyz[3 * i + 2]);
+    }
+    return;
+  }
+  std::string line;
+  int line_number{0};
+  while (std::getline(file, line)) {
+    ++line_number;
+    if (line.find_first_not_of(" \t\r") == std::string::npos || line.front() == '#') {
+      continue;
+    }
+    std::istringstream line_stream(line);
+    double coordinates[3];
+    char separator{};
+    if (!(line_stream >> coordinates[0] >> separator >> coordinates[1] >> separator >> coordinates[2])) {
+      MALIPUT_THROW_MESSAGE("Positions file: " + file_path + " has a malformed position at line " +
+                            std::to_string(line_number) + ".");
+    }
+    x->push_back(coordinates[0]);
+    y->push_back(coordinates[1]);
+    z->push_back(coordinates[2]);
+  }
+}
+
 /// Query and logs results to RoadGeometry or RoadRulebook minimizing the
 /// overhead of getting the right calls / asserting conditions.
 class RoadNetworkQuery {
@@ -391,16 +508,35 @@ class RoadNetworkQuery {
   void FindRoadPositions(const maliput::api::InertialPosition& inertial_position, double radius) {
     const auto start = std::chrono::high_resolution_clock::now();
     const std::vector<maliput::api::RoadPositionResult> results =
-        rn_->road_geometry()->FindRoadPositions(inertial_position, radius);
+        spatial_index_ != nullptr ? spatial_index_->FindRoadPositions(inertial_position, radius)
+                                  : rn_->road_geometry()->FindRoadPositions(inertial_position, radius);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("FindRoadPositions");
+      json->Key("inertial_position");
+      WriteJson(inertial_position, json);
+      json->Key("radius").Value(radius).Key("results").StartArray();
+      for (const maliput::api::RoadPositionResult& result : results) {
+        WriteJson(result, json);
+      }
+      json->EndArray();
+      EndJsonResult("FindRoadPositions", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "FindRoadPositions(inertial_position:" << inertial_position << ", radius: " << radius << ")"
             << std::endl;
     for (const maliput::api::RoadPositionResult& result : results) {
       (*out_) << "              : Result: " << result << std::endl;
     }
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("FindRoadPositions", duration.count());
+    if (compare_spatial_index_) {
+      PrintSpatialIndexComparison(duration.count(), [this, &inertial_position, radius]() {
+        rn_->road_geometry()->FindRoadPositions(inertial_position, radius);
+      });
+    }
   }
 
   /// Redirects `lane_position` to `lane_id`'s Lane::ToInertialPosition().
@@ -408,7 +544,11 @@ class RoadNetworkQuery {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
 
     if (lane == nullptr) {
-      (*out_) << "              : Result: Could not find lane. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("ToInertialPosition", "Could not find lane.");
+      } else {
+        (*out_) << "              : Result: Could not find lane. " << std::endl;
+      }
       return;
     }
 
@@ -416,6 +556,18 @@ class RoadNetworkQuery {
     const maliput::api::InertialPosition inertial_position = lane->ToInertialPosition(lane_position);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("ToInertialPosition");
+      json->Key("lane_id").Value(lane_id.string()).Key("lane_position");
+      WriteJson(lane_position, json);
+      json->Key("inertial_position");
+      WriteJson(inertial_position, json);
+      json->Key("round_trip");
+      WriteJson(rn_->road_geometry()->ToRoadPosition(inertial_position, std::nullopt), json);
+      EndJsonResult("ToInertialPosition", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "(" << lane_id.string() << ")->ToInertialPosition(lane_position: " << lane_position << ")" << std::endl;
     (*out_) << "              : Result: inertial_position:" << inertial_position << std::endl;
 
@@ -426,14 +578,18 @@ class RoadNetworkQuery {
             << ", with distance: " << result.distance << std::endl;
     (*out_) << "              : RoadPosition: " << result.road_position << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("ToInertialPosition", duration.count());
   }
 
   /// Redirects `inertial_position` to `lane_id`'s Lane::ToLanePosition().
   void ToLanePosition(const maliput::api::LaneId& lane_id, const maliput::api::InertialPosition& inertial_position) {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
     if (lane == nullptr) {
-      (*out_) << "              : Result: Could not find lane. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("ToLanePosition", "Could not find lane.");
+      } else {
+        (*out_) << "              : Result: Could not find lane. " << std::endl;
+      }
       return;
     }
 
@@ -441,20 +597,34 @@ class RoadNetworkQuery {
     const maliput::api::LanePositionResult lane_position_result = lane->ToLanePosition(inertial_position);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("ToLanePosition");
+      json->Key("lane_id").Value(lane_id.string()).Key("inertial_position");
+      WriteJson(inertial_position, json);
+      json->Key("result");
+      WriteJson(lane_position_result, json);
+      EndJsonResult("ToLanePosition", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "(" << lane_id.string() << ")->ToLanePosition(inertial_position: " << inertial_position << ")"
             << std::endl;
     (*out_) << "              : Result: lane_pos:" << lane_position_result.lane_position
             << ", nearest_pos: " << lane_position_result.nearest_position
             << ", with distance: " << lane_position_result.distance << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("ToLanePosition", duration.count());
   }
 
   /// Redirects `inertial_position` to `lane_id`'s Lane::ToSegmentPosition().
   void ToSegmentPosition(const maliput::api::LaneId& lane_id, const maliput::api::InertialPosition& inertial_position) {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
     if (lane == nullptr) {
-      (*out_) << "              : Result: Could not find lane. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("ToSegmentPosition", "Could not find lane.");
+      } else {
+        (*out_) << "              : Result: Could not find lane. " << std::endl;
+      }
       return;
     }
 
@@ -462,20 +632,34 @@ class RoadNetworkQuery {
     const maliput::api::LanePositionResult lane_position_result = lane->ToSegmentPosition(inertial_position);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("ToSegmentPosition");
+      json->Key("lane_id").Value(lane_id.string()).Key("inertial_position");
+      WriteJson(inertial_position, json);
+      json->Key("result");
+      WriteJson(lane_position_result, json);
+      EndJsonResult("ToSegmentPosition", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "(" << lane_id.string() << ")->ToSegmentPosition(inertial_position: " << inertial_position << ")"
             << std::endl;
     (*out_) << "              : Result: lane_pos:" << lane_position_result.lane_position
             << ", nearest_pos: " << lane_position_result.nearest_position
             << ", with distance: " << lane_position_result.distance << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("ToSegmentPosition", duration.count());
   }
 
   /// Redirects to `lane_id`'s Lane::GetConfluentBranches().
   void GetConfluentBranches(const maliput::api::LaneId& lane_id, const maliput::api::LaneEnd::Which& which) {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
     if (lane == nullptr) {
-      (*out_) << "              : Result: Could not find lane. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetConfluentBranches", "Could not find lane.");
+      } else {
+        (*out_) << "              : Result: Could not find lane. " << std::endl;
+      }
       return;
     }
 
@@ -484,6 +668,19 @@ class RoadNetworkQuery {
     const auto end = std::chrono::high_resolution_clock::now();
     MALIPUT_THROW_UNLESS(lane_end_set != nullptr);
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetConfluentBranches");
+      json->Key("lane_id").Value(lane_id.string());
+      json->Key("which").Value(which == maliput::api::LaneEnd::kStart ? "start" : "finish");
+      json->Key("lane_ends").StartArray();
+      for (int idx{}; idx < lane_end_set->size(); ++idx) {
+        WriteJson(lane_end_set->get(idx), json);
+      }
+      json->EndArray();
+      EndJsonResult("GetConfluentBranches", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "(" << lane_id.string() << ")->GetConfluentBranches(which: " << which << ")" << std::endl;
     for (int idx{}; idx < lane_end_set->size(); ++idx) {
       const maliput::api::LaneEnd& lane_end = lane_end_set->get(idx);
@@ -491,14 +688,18 @@ class RoadNetworkQuery {
               << " which end: " << lane_end.end << std::endl;
     }
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetConfluentBranches", duration.count());
   }
 
   /// Redirects to `lane_id`'s Lane::GetOngoingBranches().
   void GetOngoingBranches(const maliput::api::LaneId& lane_id, const maliput::api::LaneEnd::Which& which) {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
     if (lane == nullptr) {
-      (*out_) << "              : Result: Could not find lane. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetOngoingBranches", "Could not find lane.");
+      } else {
+        (*out_) << "              : Result: Could not find lane. " << std::endl;
+      }
       return;
     }
 
@@ -507,6 +708,19 @@ class RoadNetworkQuery {
     const auto end = std::chrono::high_resolution_clock::now();
     MALIPUT_THROW_UNLESS(lane_end_set != nullptr);
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetOngoingBranches");
+      json->Key("lane_id").Value(lane_id.string());
+      json->Key("which").Value(which == maliput::api::LaneEnd::kStart ? "start" : "finish");
+      json->Key("lane_ends").StartArray();
+      for (int idx{}; idx < lane_end_set->size(); ++idx) {
+        WriteJson(lane_end_set->get(idx), json);
+      }
+      json->EndArray();
+      EndJsonResult("GetOngoingBranches", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "(" << lane_id.string() << ")->GetOngoingBranches(which: " << which << ")" << std::endl;
     for (int idx{}; idx < lane_end_set->size(); ++idx) {
       const maliput::api::LaneEnd& lane_end = lane_end_set->get(idx);
@@ -514,7 +728,7 @@ class RoadNetworkQuery {
               << " which end: " << lane_end.end << std::endl;
     }
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetOngoingBranches", duration.count());
   }
 
   /// Redirects `lane_position` to `lane_id`'s Lane::GetOrientation().
@@ -522,7 +736,11 @@ class RoadNetworkQuery {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
 
     if (lane == nullptr) {
-      (*out_) << "              : Result: Could not find lane. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetOrientation", "Could not find lane.");
+      } else {
+        (*out_) << "              : Result: Could not find lane. " << std::endl;
+      }
       return;
     }
 
@@ -530,10 +748,20 @@ class RoadNetworkQuery {
     const maliput::api::Rotation rotation = lane->GetOrientation(lane_position);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetOrientation");
+      json->Key("lane_id").Value(lane_id.string()).Key("lane_position");
+      WriteJson(lane_position, json);
+      json->Key("orientation");
+      WriteJson(rotation, json);
+      EndJsonResult("GetOrientation", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "(" << lane_id.string() << ")->GetOrientation(lane_position: " << lane_position << ")" << std::endl;
     (*out_) << "              : Result: orientation:" << rotation << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetOrientation", duration.count());
   }
 
   /// Redirects `inertial_position` to RoadGeometry::ToRoadPosition().
@@ -542,20 +770,116 @@ class RoadNetworkQuery {
     const maliput::api::RoadPositionResult result = rn_->road_geometry()->ToRoadPosition(inertial_position);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("ToRoadPosition");
+      json->Key("inertial_position");
+      WriteJson(inertial_position, json);
+      json->Key("result");
+      WriteJson(result, json);
+      EndJsonResult("ToRoadPosition", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "ToRoadPosition(inertial_position: " << inertial_position << ")" << std::endl;
     (*out_) << "              : Result: nearest_pos:" << result.nearest_position
             << " with distance: " << result.distance << std::endl;
     (*out_) << "                RoadPosition: " << result.road_position << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("ToRoadPosition", duration.count());
+  }
+
+  /// Redirects the InertialPositions in `file_path` to ToRoadPositions(), which projects them concurrently.
+  /// See ReadInertialPositions() for the supported file formats.
+  void ToRoadPositionBatch(const std::string& file_path) {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+    ReadInertialPositions(file_path, &x, &y, &z);
+    const std::size_t num_positions = x.size();
+    std::vector<const maliput::api::Lane*> lane(num_positions);
+    std::vector<double> s(num_positions);
+    std::vector<double> r(num_positions);
+    std::vector<double> h(num_positions);
+    std::vector<double> distance(num_positions);
+    RoadPositionArrays road_positions{lane.data(), s.data(), r.data(), h.data(), distance.data(), num_positions};
+    ThreadPool* thread_pool = batch_thread_pool();
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    ToRoadPositions(rn_->road_geometry(), InertialPositionArrays{x.data(), y.data(), z.data(), num_positions},
+                    &road_positions, thread_pool);
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    if (json_ != nullptr) {
+      // Results are streamed one by one, so that no large string is built.
+      JsonWriter* json = StartJsonResult("ToRoadPositionBatch");
+      json->Key("file_path").Value(file_path);
+      json->Key("num_positions").Value(static_cast<std::uint64_t>(num_positions));
+      json->Key("num_threads").Value(thread_pool->num_threads());
+      json->Key("results").StartArray();
+      for (std::size_t i = 0; i < num_positions; ++i) {
+        json->StartObject();
+        json->Key("x").Value(x[i]).Key("y").Value(y[i]).Key("z").Value(z[i]).Key("lane_id");
+        if (lane[i] != nullptr) {
+          json->Value(lane[i]->id().string());
+        } else {
+          json->Null();
+        }
+        json->Key("s").Value(s[i]).Key("r").Value(r[i]).Key("h").Value(h[i]).Key("distance").Value(distance[i]);
+        json->EndObject();
+      }
+      json->EndArray();
+      EndJsonResult("ToRoadPositionBatch", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
+    (*out_) << "ToRoadPositionBatch(file_path: " << file_path << ", positions: " << num_positions
+            << ", threads: " << thread_pool->num_threads() << ")" << std::endl;
+    (*out_) << "x,y,z,lane_id,s,r,h,distance" << std::endl;
+    for (std::size_t i = 0; i < num_positions; ++i) {
+      (*out_) << x[i] << "," << y[i] << "," << z[i] << "," << (lane[i] != nullptr ? lane[i]->id().string() : "")
+              << "," << s[i] << "," << r[i] << "," << h[i] << "," << distance[i] << "\n";
+    }
+    const std::chrono::duration<double> duration = (end - start);
+    PrintQueryTime("ToRoadPositionBatch", duration.count());
+    if (duration.count() > 0.) {
+      (*out_) << "Throughput: " << num_positions / duration.count() << " positions/s" << std::endl;
+    }
   }
 
   /// Looks for all the maximum speed limits allowed at `lane_id`.
   void GetMaxSpeedLimit(const maliput::api::LaneId& lane_id) {
+    const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
+    if (lane == nullptr) {
+      if (json_ != nullptr) {
+        WriteJsonError("GetMaxSpeedLimit", "Could not find lane.");
+      } else {
+        (*out_) << "Could not find lane." << std::endl;
+      }
+      return;
+    }
     const auto start = std::chrono::high_resolution_clock::now();
-    const maliput::api::rules::RoadRulebook::QueryResults query_result = FindRulesFor(lane_id);
+    const maliput::api::rules::RoadRulebook::QueryResults query_result = FindRulesFor(lane);
 
     const int n_speed_limits = static_cast<int>(query_result.speed_limit.size());
+    if (json_ != nullptr) {
+      // The most restrictive speed limit, as in the text output.
+      const maliput::api::rules::SpeedLimitRule* speed_limit{};
+      for (const auto& speed_val : query_result.speed_limit) {
+        if (speed_limit == nullptr || speed_val.second.max() < speed_limit->max()) {
+          speed_limit = &speed_val.second;
+        }
+      }
+      JsonWriter* json = StartJsonResult("GetMaxSpeedLimit");
+      json->Key("lane_id").Value(lane_id.string()).Key("speed_limit");
+      if (speed_limit != nullptr) {
+        WriteJson(*speed_limit, json);
+      } else {
+        json->Null();
+      }
+      const auto end = std::chrono::high_resolution_clock::now();
+      EndJsonResult("GetMaxSpeedLimit", std::chrono::duration<double>(end - start).count());
+      return;
+    }
     if (n_speed_limits > 0) {
       double max_speed = query_result.speed_limit.begin()->second.max();
       maliput::api::rules::SpeedLimitRule::Id max_speed_id = query_result.speed_limit.begin()->first;
@@ -572,17 +896,49 @@ class RoadNetworkQuery {
     }
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetMaxSpeedLimit", duration.count());
   }
 
   /// Looks for all the direction usages at `lane_id`.
   void GetDirectionUsage(const maliput::api::LaneId& lane_id) {
+    const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
+    if (lane == nullptr) {
+      if (json_ != nullptr) {
+        WriteJsonError("GetDirectionUsage", "Could not find lane.");
+      } else {
+        (*out_) << "Could not find lane." << std::endl;
+      }
+      return;
+    }
     const auto start = std::chrono::high_resolution_clock::now();
-    const maliput::api::rules::RoadRulebook::QueryResults query_result = FindRulesFor(lane_id);
+    const maliput::api::rules::RoadRulebook::QueryResults query_result = FindRulesFor(lane);
 
     const int n_rules = static_cast<int>(query_result.direction_usage.size());
     const std::vector<std::string> direction_usage_names = DirectionUsageRuleNames();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetDirectionUsage");
+      json->Key("lane_id").Value(lane_id.string()).Key("rules").StartArray();
+      for (const auto& direction_rule : query_result.direction_usage) {
+        json->StartObject().Key("id").Value(direction_rule.second.id().string()).Key("zone");
+        WriteJson(direction_rule.second.zone(), json);
+        json->Key("states").StartArray();
+        for (const auto& state : direction_rule.second.states()) {
+          const int state_type = int(state.second.type());
+          if (state_type < 0 || state_type >= int(direction_usage_names.size())) {
+            json->Null();
+          } else {
+            json->Value(direction_usage_names[state_type]);
+          }
+        }
+        json->EndArray().EndObject();
+      }
+      json->EndArray();
+      const auto end = std::chrono::high_resolution_clock::now();
+      EndJsonResult("GetDirectionUsage", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     if (n_rules > 0) {
       for (const auto& direction_rule : query_result.direction_usage) {
         const auto& states = direction_rule.second.states();
@@ -603,7 +959,7 @@ class RoadNetworkQuery {
     }
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetDirectionUsage", duration.count());
   }
 
 #pragma GCC diagnostic push
@@ -611,9 +967,42 @@ class RoadNetworkQuery {
   /// Gets all right-of-way rules for the given `lane_s_range`.
   void GetRightOfWay(const maliput::api::LaneSRange& lane_s_range) {
     const auto start = std::chrono::high_resolution_clock::now();
-    const maliput::api::rules::RoadRulebook::QueryResults results = rn_->rulebook()->FindRules({lane_s_range}, 0.);
+    const maliput::api::rules::RoadRulebook::QueryResults results = rule_index()->FindRules(lane_s_range, 0.);
     maliput::api::rules::RightOfWayRuleStateProvider* right_of_way_rule_state_provider =
         rn_->right_of_way_rule_state_provider();
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetRightOfWay");
+      json->Key("lane_s_range");
+      WriteJson(lane_s_range, json);
+      json->Key("rules").StartArray();
+      for (const auto& rule : results.right_of_way) {
+        std::ostringstream zone_type;
+        zone_type << rule.second.zone_type();
+        json->StartObject().Key("id").Value(rule.second.id().string()).Key("zone");
+        WriteJson(rule.second.zone(), json);
+        json->Key("zone_type").Value(zone_type.str()).Key("static").Value(rule.second.is_static());
+        json->Key("states").StartArray();
+        for (const auto& entry : rule.second.states()) {
+          json->Value(entry.first.string());
+        }
+        json->EndArray().Key("current_state");
+        if (rule.second.is_static()) {
+          json->Value(rule.second.static_state().id().string());
+        } else {
+          const auto rule_state_result = right_of_way_rule_state_provider->GetState(rule.second.id());
+          if (rule_state_result.has_value()) {
+            json->Value(rule_state_result->state.string());
+          } else {
+            json->Null();
+          }
+        }
+        json->EndObject();
+      }
+      json->EndArray();
+      const auto end = std::chrono::high_resolution_clock::now();
+      EndJsonResult("GetRightOfWay", std::chrono::duration<double>(end - start).count());
+      return;
+    }
     (*out_) << "Right of way for " << lane_s_range << ":" << std::endl;
     for (const auto& rule : results.right_of_way) {
       (*out_) << "    Rule(id: " << rule.second.id().string() << ", zone: " << rule.second.zone() << ", zone-type: '"
@@ -637,15 +1026,38 @@ class RoadNetworkQuery {
     }
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetRightOfWay", duration.count());
   }
 #pragma GCC diagnostic pop
 
   /// Gets all discrete-value-rules rules for the given `lane_s_range`.
   void GetDiscreteValueRule(const maliput::api::LaneSRange& lane_s_range) {
     const auto start = std::chrono::high_resolution_clock::now();
-    const maliput::api::rules::RoadRulebook::QueryResults results = rn_->rulebook()->FindRules({lane_s_range}, 0.);
+    const maliput::api::rules::RoadRulebook::QueryResults results = rule_index()->FindRules(lane_s_range, 0.);
     maliput::api::rules::DiscreteValueRuleStateProvider* state_provider = rn_->discrete_value_rule_state_provider();
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetDiscreteValueRules");
+      json->Key("lane_s_range");
+      WriteJson(lane_s_range, json);
+      json->Key("rules").StartArray();
+      for (const auto& rule : results.discrete_value_rules) {
+        json->StartObject().Key("id").Value(rule.second.id().string()).Key("zone");
+        WriteJson(rule.second.zone(), json);
+        json->Key("state");
+        const std::optional<maliput::api::rules::DiscreteValueRuleStateProvider::StateResult> rule_state =
+            state_provider->GetState(rule.second.id());
+        if (rule_state.has_value()) {
+          WriteJson(rule_state->state, json);
+        } else {
+          json->Null();
+        }
+        json->EndObject();
+      }
+      json->EndArray();
+      const auto end = std::chrono::high_resolution_clock::now();
+      EndJsonResult("GetDiscreteValueRules", std::chrono::duration<double>(end - start).count());
+      return;
+    }
     (*out_) << "DiscreteValueRules for " << lane_s_range << ":" << std::endl;
     for (const auto& rule : results.discrete_value_rules) {
       const std::optional<maliput::api::rules::DiscreteValueRuleStateProvider::StateResult> rule_state =
@@ -668,14 +1080,37 @@ class RoadNetworkQuery {
     }
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetDiscreteValueRules", duration.count());
   }
 
   /// Gets all range-value-rules rules for the given `lane_s_range`.
   void GetRangeValueRule(const maliput::api::LaneSRange& lane_s_range) {
     const auto start = std::chrono::high_resolution_clock::now();
-    const maliput::api::rules::RoadRulebook::QueryResults results = rn_->rulebook()->FindRules({lane_s_range}, 0.);
+    const maliput::api::rules::RoadRulebook::QueryResults results = rule_index()->FindRules(lane_s_range, 0.);
     maliput::api::rules::RangeValueRuleStateProvider* state_provider = rn_->range_value_rule_state_provider();
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetRangeValueRules");
+      json->Key("lane_s_range");
+      WriteJson(lane_s_range, json);
+      json->Key("rules").StartArray();
+      for (const auto& rule : results.range_value_rules) {
+        json->StartObject().Key("id").Value(rule.second.id().string()).Key("zone");
+        WriteJson(rule.second.zone(), json);
+        json->Key("state");
+        const std::optional<maliput::api::rules::RangeValueRuleStateProvider::StateResult> rule_state =
+            state_provider->GetState(rule.second.id());
+        if (rule_state.has_value()) {
+          WriteJson(rule_state->state, json);
+        } else {
+          json->Null();
+        }
+        json->EndObject();
+      }
+      json->EndArray();
+      const auto end = std::chrono::high_resolution_clock::now();
+      EndJsonResult("GetRangeValueRules", std::chrono::duration<double>(end - start).count());
+      return;
+    }
     (*out_) << "RangeValueRules for " << lane_s_range << ":" << std::endl;
     for (const auto& rule : results.range_value_rules) {
       const std::optional<maliput::api::rules::RangeValueRuleStateProvider::StateResult> rule_state =
@@ -699,7 +1134,7 @@ class RoadNetworkQuery {
     }
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetRangeValueRules", duration.count());
   }
 
   /// Gets all right-of-way rules' states for a given phase in a given phase
@@ -709,33 +1144,69 @@ class RoadNetworkQuery {
     const auto start = std::chrono::high_resolution_clock::now();
     const maliput::api::rules::PhaseRingBook* phase_ring_book = rn_->phase_ring_book();
     if (phase_ring_book == nullptr) {
-      (*out_) << "Road network has no phase ring book" << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetPhaseRightOfWay", "Road network has no phase ring book");
+      } else {
+        (*out_) << "Road network has no phase ring book" << std::endl;
+      }
       return;
     }
 
     const maliput::api::rules::RoadRulebook* road_rule_book = rn_->rulebook();
     if (road_rule_book == nullptr) {
-      (*out_) << "Road network has no road rule book" << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetPhaseRightOfWay", "Road network has no road rule book");
+      } else {
+        (*out_) << "Road network has no road rule book" << std::endl;
+      }
       return;
     }
 
     std::optional<maliput::api::rules::PhaseRing> phase_ring = phase_ring_book->GetPhaseRing(phase_ring_id);
     if (!phase_ring.has_value()) {
-      (*out_) << "'" << phase_ring_id.string() << "' is not a known phase ring" << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetPhaseRightOfWay", "'" + phase_ring_id.string() + "' is not a known phase ring");
+      } else {
+        (*out_) << "'" << phase_ring_id.string() << "' is not a known phase ring" << std::endl;
+      }
       return;
     }
 
     auto it = phase_ring->phases().find(phase_id);
     if (it == phase_ring->phases().end()) {
-      (*out_) << "'" << phase_id.string() << "' is not a phase in phase ring '" << phase_ring_id.string() << "'"
-              << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetPhaseRightOfWay",
+                       "'" + phase_id.string() + "' is not a phase in phase ring '" + phase_ring_id.string() + "'");
+      } else {
+        (*out_) << "'" << phase_id.string() << "' is not a phase in phase ring '" << phase_ring_id.string() << "'"
+                << std::endl;
+      }
       return;
     }
 
     const maliput::api::rules::Phase& phase = it->second;
-    (*out_) << "Right of way for " << phase_id.string() << ":" << std::endl;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetPhaseRightOfWay");
+      json->Key("phase_ring_id").Value(phase_ring_id.string()).Key("phase_id").Value(phase_id.string());
+      json->Key("rules").StartArray();
+      for (const auto& rule_id_to_rule_state_id : phase.rule_states()) {
+        const maliput::api::rules::RightOfWayRule rule = road_rule_book->GetRule(rule_id_to_rule_state_id.first);
+        std::ostringstream zone_type;
+        zone_type << rule.zone_type();
+        json->StartObject().Key("id").Value(rule.id().string()).Key("zone");
+        WriteJson(rule.zone(), json);
+        json->Key("zone_type").Value(zone_type.str()).Key("static").Value(rule.is_static());
+        json->Key("current_state").Value(rule_id_to_rule_state_id.second.string());
+        json->EndObject();
+      }
+      json->EndArray();
+      const auto end = std::chrono::high_resolution_clock::now();
+      EndJsonResult("GetPhaseRightOfWay", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+    (*out_) << "Right of way for " << phase_id.string() << ":" << std::endl;
     for (const auto& rule_id_to_rule_state_id : phase.rule_states()) {
       const maliput::api::rules::RightOfWayRule rule = road_rule_book->GetRule(rule_id_to_rule_state_id.first);
       const maliput::api::rules::RightOfWayRule::State& rule_state = rule.states().at(rule_id_to_rule_state_id.second);
@@ -748,14 +1219,18 @@ class RoadNetworkQuery {
 #pragma GCC diagnostic pop
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetPhaseRightOfWay", duration.count());
   }
 
   /// Gets a lane boundaries for `lane_id` at `s`.
   void GetLaneBounds(const maliput::api::LaneId& lane_id, double s) {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
     if (lane == nullptr) {
-      std::cerr << " Could not find lane. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetLaneBounds", "Could not find lane.");
+      } else {
+        std::cerr << " Could not find lane. " << std::endl;
+      }
       return;
     }
     const maliput::api::RBounds segment_bounds = lane->segment_bounds(s);
@@ -764,18 +1239,32 @@ class RoadNetworkQuery {
     const maliput::api::RBounds lane_bounds = lane->lane_bounds(s);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetLaneBounds");
+      json->Key("lane_id").Value(lane_id.string()).Key("s").Value(s).Key("lane_bounds");
+      WriteJson(lane_bounds, json);
+      json->Key("segment_bounds");
+      WriteJson(segment_bounds, json);
+      EndJsonResult("GetLaneBounds", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "Lateral boundaries for  " << lane_id.string() << ":" << std::endl
             << "    [" << segment_bounds.min() << "; " << lane_bounds.min() << "; " << lane_bounds.max() << "; "
             << segment_bounds.max() << "]" << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetLaneBounds", duration.count());
   }
 
   /// Gets a segment boundary for `segment_id` at `s`.
   void GetSegmentBounds(const maliput::api::SegmentId& segment_id, double s) {
     const maliput::api::Segment* segment = rn_->road_geometry()->ById().GetSegment(segment_id);
     if (segment == nullptr) {
-      std::cerr << " Could not find segment. " << std::endl;
+      if (json_ != nullptr) {
+        WriteJsonError("GetSegmentBounds", "Could not find segment.");
+      } else {
+        std::cerr << " Could not find segment. " << std::endl;
+      }
       return;
     }
     // Segments bounds are computed from a Lane.
@@ -783,26 +1272,43 @@ class RoadNetworkQuery {
     const maliput::api::RBounds segment_bounds = segment->lane(0)->segment_bounds(s);
     const auto end = std::chrono::high_resolution_clock::now();
 
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("GetSegmentBounds");
+      json->Key("segment_id").Value(segment_id.string()).Key("s").Value(s).Key("segment_bounds");
+      WriteJson(segment_bounds, json);
+      EndJsonResult("GetSegmentBounds", std::chrono::duration<double>(end - start).count());
+      return;
+    }
+
     (*out_) << "Segment boundaries for segment " << segment_id.string() << ":" << std::endl
             << "    [" << segment_bounds.min() << "; " << segment_bounds.max() << "]" << std::endl;
 
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetSegmentBounds", duration.count());
   }
 
   /// Gets the lane length for `lane_id`.
   void GetLaneLength(const maliput::api::LaneId& lane_id) {
     const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
+    if (lane == nullptr) {
+      if (json_ != nullptr) {
+        WriteJsonError("GetLaneLength", "Could not find lane.");
+      } else {
+        std::cerr << " Could not find lane. " << std::endl;
+      }
+      return;
+    }
     const auto start = std::chrono::high_resolution_clock::now();
     const double length = lane->length();
     const auto end = std::chrono::high_resolution_clock::now();
-    if (lane == nullptr) {
-      std::cerr << " Could not find lane. " << std::endl;
+    if (json_ != nullptr) {
+      StartJsonResult("GetLaneLength")->Key("lane_id").Value(lane_id.string()).Key("length").Value(length);
+      EndJsonResult("GetLaneLength", std::chrono::duration<double>(end - start).count());
       return;
     }
     (*out_) << "Lane length for  " << lane_id.string() << ":    [" << std::to_string(length) << " m]" << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetLaneLength", duration.count());
   }
 
   /// Gets number of lanes in the RoadGeometry.
@@ -810,9 +1316,14 @@ class RoadNetworkQuery {
     const auto start = std::chrono::high_resolution_clock::now();
     const std::size_t num_lanes{rn_->road_geometry()->ById().GetLanes().size()};
     const auto end = std::chrono::high_resolution_clock::now();
+    if (json_ != nullptr) {
+      StartJsonResult("GetNumberOfLanes")->Key("num_lanes").Value(static_cast<std::uint64_t>(num_lanes));
+      EndJsonResult("GetNumberOfLanes", std::chrono::duration<double>(end - start).count());
+      return;
+    }
     (*out_) << "Number of lanes in the RoadGeometry: " << num_lanes << std::endl;
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("GetNumberOfLanes", duration.count());
   }
 
   /// Gets all the Lanes (according to the overlapping type) in respect to a BoundingRegion
@@ -823,9 +1334,26 @@ class RoadNetworkQuery {
         {maliput::math::OverlappingType::kIntersected, "intersected"},
         {maliput::math::OverlappingType::kContained, "contained"}};
     const auto start = std::chrono::high_resolution_clock::now();
+    // The spatial index only classifies the lanes whose boxes intersect the object's box with ComputeLaneOverlapping(),
+    // the rest are disjointed.
     const std::vector<const maliput::api::Lane*> overlapping_lanes =
-        object_query_->FindOverlappingLanesIn(bounding_object_ptr, overlapping_type);
+        spatial_index_ != nullptr
+            ? spatial_index_->FindOverlappingLanesIn(bounding_object_ptr->bounding_region(), overlapping_type,
+                                                     kOverlappingSamplingStep, overlapping_thread_pool_.get())
+            : FindOverlappingLanesWithoutIndex(bounding_object_ptr, overlapping_type);
     const auto end = std::chrono::high_resolution_clock::now();
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("FindOverlappingLanesIn");
+      json->Key("overlapping_type").Value(overlapping_type_to_string.at(overlapping_type)).Key("object");
+      WriteJsonObject(bounding_object_ptr);
+      json->Key("lane_ids").StartArray();
+      for (const auto& lane : overlapping_lanes) {
+        json->Value(lane->id().string());
+      }
+      json->EndArray();
+      EndJsonResult("FindOverlappingLanesIn", std::chrono::duration<double>(end - start).count());
+      return;
+    }
     (*out_) << "The " << overlapping_type_to_string.at(overlapping_type)
             << " overlapping lanes for the object: " << std::endl;
     PrintObjectProperties(bounding_object_ptr);
@@ -834,7 +1362,59 @@ class RoadNetworkQuery {
       (*out_) << "  Lane Id: " << lane->id() << std::endl;
     };
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("FindOverlappingLanesIn", duration.count());
+    if (compare_spatial_index_) {
+      // The same test runs on every lane, so only the pruning is timed.
+      PrintSpatialIndexComparison(duration.count(), [this, bounding_object_ptr, overlapping_type]() {
+        maliput::integration::FindOverlappingLanesIn(rn_->road_geometry(), bounding_object_ptr->bounding_region(),
+                                                     overlapping_type, kOverlappingSamplingStep,
+                                                     overlapping_thread_pool_.get());
+      });
+    }
+  }
+
+  /// Builds a LaneSpatialIndex of the RoadGeometry, used from then on by FindRoadPositions() and
+  /// FindOverlappingLanesIn().
+  ///
+  /// @param compare Whether those queries should also run without the index, to print both query times.
+  void EnableSpatialIndex(bool compare) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    spatial_index_ = std::make_unique<LaneSpatialIndex>(rn_->road_geometry());
+    const auto end = std::chrono::high_resolution_clock::now();
+    const std::chrono::duration<double> duration = (end - start);
+    if (json_ != nullptr) {
+      maliput::log()->info("Spatial index built for {} lanes in {} s", spatial_index_->num_lanes(), duration.count());
+    } else {
+      (*out_) << "Spatial index built for " << spatial_index_->num_lanes() << " lanes in " << duration.count()
+              << " s" << std::endl;
+    }
+    compare_spatial_index_ = compare;
+  }
+
+  /// Prints, for each command that ran, the number of queries and their latency mean, percentiles and maximum.
+  void PrintLatencySummary() const {
+    (*out_) << "Query latency summary [s]:" << std::endl;
+    (*out_) << "  " << std::left << std::setw(28) << "command" << std::right << std::setw(10) << "count"
+            << std::setw(12) << "mean" << std::setw(12) << "p50" << std::setw(12) << "p95" << std::setw(12) << "p99"
+            << std::setw(12) << "max" << std::endl;
+    for (const auto& command_histogram : latency_histograms_) {
+      const LatencySummary summary = command_histogram.second.Summarize();
+      (*out_) << "  " << std::left << std::setw(28) << command_histogram.first << std::right << std::setw(10)
+              << summary.count << std::setw(12) << summary.mean << std::setw(12) << summary.p50 << std::setw(12)
+              << summary.p95 << std::setw(12) << summary.p99 << std::setw(12) << summary.max << std::endl;
+    }
+  }
+
+  /// @returns The latency histograms of the queries that ran, keyed by command name.
+  const std::map<std::string, LatencyHistogram>& latency_histograms() const { return latency_histograms_; }
+
+  /// Makes FindOverlappingLanesIn() classify the lanes on the threads of `thread_pool`. See
+  /// maliput::integration::FindOverlappingLanesIn().
+  ///
+  /// @param thread_pool The pool to classify the lanes on. It must not be nullptr.
+  void EnableParallelOverlapping(std::unique_ptr<ThreadPool> thread_pool) {
+    MALIPUT_THROW_UNLESS(thread_pool != nullptr);
+    overlapping_thread_pool_ = std::move(thread_pool);
   }
 
   /// Gets all the lanes needed to get from the position of an Object to the position of another Object
@@ -844,6 +1424,21 @@ class RoadNetworkQuery {
     const std::optional<const maliput::api::LaneSRoute> route =
         object_query_->Route(bounding_object_1_ptr, bounding_object_2_ptr);
     const auto end = std::chrono::high_resolution_clock::now();
+    if (json_ != nullptr) {
+      JsonWriter* json = StartJsonResult("Route");
+      json->Key("from");
+      WriteJsonObject(bounding_object_1_ptr);
+      json->Key("to");
+      WriteJsonObject(bounding_object_2_ptr);
+      json->Key("route");
+      if (route.has_value()) {
+        WriteJson(route.value(), json);
+      } else {
+        json->Null();
+      }
+      EndJsonResult("Route", std::chrono::duration<double>(end - start).count());
+      return;
+    }
     if (route.has_value()) {
       (*out_) << "The Route from the object: " << std::endl;
       PrintObjectProperties(bounding_object_1_ptr);
@@ -857,61 +1452,152 @@ class RoadNetworkQuery {
       PrintObjectProperties(bounding_object_2_ptr);
     };
     const std::chrono::duration<double> duration = (end - start);
-    PrintQueryTime(duration.count());
+    PrintQueryTime("Route", duration.count());
   }
 
+  /// Makes every query write a single line with a JSON object instead of human readable text. The object holds the
+  /// `command` name, its inputs, its results and the `elapsed_s` query time, or an `error` when the query could not
+  /// run. Comparisons with the brute force queries, see EnableSpatialIndex(), are not written.
+  void EnableJsonOutput() { json_ = std::make_unique<JsonWriter>(out_); }
+
+  /// @returns Whether EnableJsonOutput() was called.
+  bool json_output() const { return json_ != nullptr; }
+
   /// @return the object_book_ variable.
   maliput::object::ManualObjectBook<maliput::math::Vector3>* GetManualObjectBook() { return object_book_.get(); }
 
  private:
-  // Prints "Elapsed Query Time: < @p sec >".
-  static void PrintQueryTime(double sec) { std::cout << "Elapsed Query Time: " << sec << " s" << std::endl; }
+  // Runs FindOverlappingLanesIn() for @p object without the spatial index: concurrently when
+  // EnableParallelOverlapping() was called, with maliput object's SimpleObjectQuery otherwise.
+  std::vector<const maliput::api::Lane*> FindOverlappingLanesWithoutIndex(
+      const maliput::object::api::Object<maliput::math::Vector3>* object,
+      maliput::math::OverlappingType overlapping_type) const {
+    if (overlapping_thread_pool_ != nullptr) {
+      return maliput::integration::FindOverlappingLanesIn(rn_->road_geometry(), object->bounding_region(),
+                                                          overlapping_type, kOverlappingSamplingStep,
+                                                          overlapping_thread_pool_.get());
+    }
+    return object_query_->FindOverlappingLanesIn(object, overlapping_type);
+  }
+
+  // Times @p brute_force_query, the same query that took @p indexed_time seconds with the spatial index, and prints
+  // both times.
+  template <typename Query>
+  void PrintSpatialIndexComparison(double indexed_time, Query brute_force_query) const {
+    const auto start = std::chrono::high_resolution_clock::now();
+    brute_force_query();
+    const auto end = std::chrono::high_resolution_clock::now();
+    const std::chrono::duration<double> duration = (end - start);
+    (*out_) << "Brute Force Query Time: " << duration.count() << " s";
+    if (indexed_time > 0.) {
+      (*out_) << " (spatial index speedup: " << duration.count() / indexed_time << "x)";
+    }
+    (*out_) << std::endl;
+  }
+
+  // Opens the JSON object of a result of @p command and writes the command name.
+  // @returns The JsonWriter to write the inputs and results of the query with.
+  JsonWriter* StartJsonResult(const std::string& command) {
+    json_->StartObject().Key("command").Value(command);
+    return json_.get();
+  }
+
+  // Writes @p sec as the query time, closes the JSON object StartJsonResult() opened and records @p sec in the latency
+  // histogram of @p command.
+  void EndJsonResult(const std::string& command, double sec) {
+    json_->Key("elapsed_s").Value(sec).EndObject();
+    (*out_) << '\n';
+    latency_histograms_[command].Record(sec);
+  }
+
+  // Writes a JSON object with the @p error that prevented @p command from running.
+  void WriteJsonError(const std::string& command, const std::string& error) {
+    json_->StartObject().Key("command").Value(command).Key("error").Value(error).EndObject();
+    (*out_) << '\n';
+  }
+
+  // Writes the Object id and properties (size, position and orientation) as a JSON object.
+  void WriteJsonObject(const maliput::object::api::Object<maliput::math::Vector3>* object_ptr) {
+    const maliput::math::BoundingBox* bounding_box_ptr =
+        dynamic_cast<const maliput::math::BoundingBox*>(&(object_ptr->bounding_region()));
+    const maliput::math::Vector3 size = bounding_box_ptr->box_size();
+    const maliput::math::Vector3 orientation = bounding_box_ptr->get_orientation().vector();
+    json_->StartObject().Key("id").Value(object_ptr->id().string());
+    json_->Key("size").StartObject().Key("x").Value(size.x()).Key("y").Value(size.y()).Key("z").Value(size.z());
+    json_->EndObject().Key("position");
+    WriteJson(maliput::api::InertialPosition::FromXyz(object_ptr->position()), json_.get());
+    json_->Key("orientation").StartObject().Key("roll").Value(orientation.x()).Key("pitch").Value(orientation.y());
+    json_->Key("yaw").Value(orientation.z()).EndObject().EndObject();
+  }
+
+  // Prints "Elapsed Query Time: < @p sec >" and records @p sec in the latency histogram of @p command.
+  void PrintQueryTime(const std::string& command, double sec) {
+    (*out_) << "Elapsed Query Time: " << sec << " s" << std::endl;
+    latency_histograms_[command].Record(sec);
+  }
 
   // Prints the Object properties (size, position and orientation).
-  static void PrintObjectProperties(const maliput::object::api::Object<maliput::math::Vector3>* object_ptr) {
+  void PrintObjectProperties(const maliput::object::api::Object<maliput::math::Vector3>* object_ptr) const {
     // TODO Add size and orientation from the bounding region to the print.
     // std::cout << "  Object Id: "<< object_ptr->id()<<std::endl;
     const maliput::math::BoundingBox* bounding_box_ptr =
         dynamic_cast<const maliput::math::BoundingBox*>(&(object_ptr->bounding_region()));
-    std::cout << "  Size:        " << bounding_box_ptr->box_size() << std::endl;
-    std::cout << "  Position:    " << object_ptr->position() << std::endl;
-    std::cout << "  Orientation: " << bounding_box_ptr->get_orientation().vector() << std::endl;
+    (*out_) << "  Size:        " << bounding_box_ptr->box_size() << std::endl;
+    (*out_) << "  Position:    " << object_ptr->position() << std::endl;
+    (*out_) << "  Orientation: " << bounding_box_ptr->get_orientation().vector() << std::endl;
   }
 
-  // Finds QueryResults of Rules for `lane_id`.
-  maliput::api::rules::RoadRulebook::QueryResults FindRulesFor(const maliput::api::LaneId& lane_id) {
-    const maliput::api::Lane* lane = rn_->road_geometry()->ById().GetLane(lane_id);
-    if (lane == nullptr) {
-      std::cerr << " Could not find lane. " << std::endl;
-      return maliput::api::rules::RoadRulebook::QueryResults();
-    }
+  // Finds QueryResults of Rules for @p lane.
+  maliput::api::rules::RoadRulebook::QueryResults FindRulesFor(const maliput::api::Lane* lane) {
+    return rule_index()->FindRules(lane->id());
+  }
 
-    const maliput::api::SRange s_range(0., lane->length());
-    const maliput::api::LaneSRange lane_s_range(lane->id(), s_range);
-    const std::vector<maliput::api::LaneSRange> lane_s_ranges(1, lane_s_range);
+  // @returns The LaneRuleIndex of the rulebook, building it on first use.
+  const LaneRuleIndex* rule_index() {
+    if (rule_index_ == nullptr) {
+      rule_index_ = std::make_unique<LaneRuleIndex>(rn_->rulebook());
+    }
+    return rule_index_.get();
+  }
 
-    return rn_->rulebook()->FindRules(lane_s_ranges, 0.);
+  // @returns The pool ToRoadPositionBatch() projects on, creating it on first use so that its threads are spawned
+  //          once per session rather than once per batch.
+  ThreadPool* batch_thread_pool() {
+    if (batch_thread_pool_ == nullptr) {
+      batch_thread_pool_ = std::make_unique<ThreadPool>(0);
+    }
+    return batch_thread_pool_.get();
   }
 
   std::ostream* out_{};
   maliput::api::RoadNetwork* rn_{};
   std::unique_ptr<maliput::object::ManualObjectBook<maliput::math::Vector3>> object_book_;
   std::unique_ptr<maliput::object::SimpleObjectQuery> object_query_;
+  std::unique_ptr<LaneSpatialIndex> spatial_index_;
+  bool compare_spatial_index_{false};
+  std::unique_ptr<ThreadPool> overlapping_thread_pool_;
+  std::unique_ptr<ThreadPool> batch_thread_pool_;
+  std::unique_ptr<LaneRuleIndex> rule_index_;
+  // Set when results are written as JSON.
+  std::unique_ptr<JsonWriter> json_;
+  // Latencies of the queries, keyed by command name.
+  std::map<std::string, LatencyHistogram> latency_histograms_;
 };
 
 /// @return A LaneId whose string representation is `*argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::LaneId LaneIdFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
   return maliput::api::LaneId(std::string(*argv));
 }
 
 /// @return An OverlappingType according to the selected by `*argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr or `*argv`
+///                                          is not a valid OverlappingType.
 maliput::math::OverlappingType OverlappingTypeFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
 
   static const std::map<std::string, maliput::math::OverlappingType> string_to_overlapping_type{
       {"disjointed", maliput::math::OverlappingType::kDisjointed},
@@ -919,21 +1605,24 @@ maliput::math::OverlappingType OverlappingTypeFromCLI(char** argv) {
       {"contained", maliput::math::OverlappingType::kContained}};
 
   const std::string overlapping_type_str = *argv;
-  MALIPUT_DEMAND(string_to_overlapping_type.find(overlapping_type_str) != string_to_overlapping_type.end());
-
-  return string_to_overlapping_type.at(overlapping_type_str);
+  const auto overlapping_type_it = string_to_overlapping_type.find(overlapping_type_str);
+  if (overlapping_type_it == string_to_overlapping_type.end()) {
+    MALIPUT_THROW_MESSAGE("Invalid OverlappingType: " + overlapping_type_str);
+  }
+  return overlapping_type_it->second;
 }
 
 /// @return A maliput Object with the selected id.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr or any
+///                                          size is negative.
 std::unique_ptr<maliput::object::api::Object<maliput::math::Vector3>> ObjectFromCLI(const std::string id, char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
 
   const double s_x = std::strtod(argv[0], nullptr);
   const double s_y = std::strtod(argv[1], nullptr);
   const double s_z = std::strtod(argv[2], nullptr);
-  MALIPUT_DEMAND(s_x >= 0 && s_y >= 0 && s_z >= 0);
+  MALIPUT_THROW_UNLESS(s_x >= 0 && s_y >= 0 && s_z >= 0);
   const maliput::math::Vector3 size{s_x, s_y, s_z};
 
   const double p_x = std::strtod(argv[3], nullptr);
@@ -953,32 +1642,34 @@ std::unique_ptr<maliput::object::api::Object<maliput::math::Vector3>> ObjectFrom
 
 /// @return A SegmentId whose string representation is `*argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::SegmentId SegmentIdFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
   return maliput::api::SegmentId(std::string(*argv));
 }
 
 /// @return A PhaseRing::Id whose string representation is `*argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::rules::PhaseRing::Id PhaseRingIdFromCLI(char** argv) {
+  MALIPUT_THROW_UNLESS(argv != nullptr);
   return maliput::api::rules::PhaseRing::Id(std::string(*argv));
 }
 
 /// @return A Phase::Id whose string representation is `*argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::rules::Phase::Id PhaseIdFromCLI(char** argv) {
+  MALIPUT_THROW_UNLESS(argv != nullptr);
   return maliput::api::rules::Phase::Id(std::string(*argv));
 }
 
 /// @return An SRange whose string representation is a sequence 's0 s1'
 ///         pointed by `argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::SRange SRangeFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
 
   const double s0 = std::strtod(argv[0], nullptr);
   const double s1 = std::strtod(argv[1], nullptr);
@@ -988,9 +1679,9 @@ maliput::api::SRange SRangeFromCLI(char** argv) {
 /// @return A LaneSRange whose string representation is a sequence
 ///         'lane_id s0 s1' pointed by `argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::LaneSRange LaneSRangeFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
 
   return maliput::api::LaneSRange(LaneIdFromCLI(argv), SRangeFromCLI(&(argv[1])));
 }
@@ -998,9 +1689,9 @@ maliput::api::LaneSRange LaneSRangeFromCLI(char** argv) {
 /// @return A LanePosition whose string representation is a sequence 's r h'
 ///         pointed by `argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::LanePosition LanePositionFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
 
   const double s = std::strtod(argv[0], nullptr);
   const double r = std::strtod(argv[1], nullptr);
@@ -1011,9 +1702,9 @@ maliput::api::LanePosition LanePositionFromCLI(char** argv) {
 /// @return A InertialPosition whose string representation is a sequence 'x y z'
 ///         pointed by `argv`.
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr.
 maliput::api::InertialPosition InertialPositionFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
 
   const double x = std::strtod(argv[0], nullptr);
   const double y = std::strtod(argv[1], nullptr);
@@ -1024,27 +1715,25 @@ maliput::api::InertialPosition InertialPositionFromCLI(char** argv) {
 /// @return A LaneEnd::Which whose string representation is `*argv`.
 ///
 /// @pre `argv` is not nullptr.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr or `*argv`
+///                                          is neither `start` nor `finish`.
 maliput::api::LaneEnd::Which LaneEndWhichFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
   const std::string which(*argv);
   if (which == "start") {
     return maliput::api::LaneEnd::kStart;
   } else if (which == "finish") {
     return maliput::api::LaneEnd::kFinish;
-  } else {
-    maliput::log()->error("Invalid LaneEnd::Which: {}\nRun 'maliput_query --help' for help.\n", which);
-    std::exit(1);
   }
+  MALIPUT_THROW_MESSAGE("Invalid LaneEnd::Which: " + which);
 }
 
 /// @return A radius whose string representation is `*argv`.
 /// @pre `argv` is not nullptr.
-/// @throws maliput::common::assertion_error When the represented number
-///                                          is negative.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr or the
+///                                          represented number is negative.
 double RadiusFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
   const double radius = std::strtod(argv[0], nullptr);
   MALIPUT_THROW_UNLESS(radius >= 0.);
   return radius;
@@ -1052,169 +1741,396 @@ double RadiusFromCLI(char** argv) {
 
 /// @return An s coordinate position whose string representation is `*argv`.
 /// @pre `argv` is not nullptr.
-/// @throws maliput::common::assertion_error When the represented number
-///                                          is negative.
-/// @warning This function will abort if preconditions are not met.
+/// @throws maliput::common::assertion_error When `argv` is nullptr or the
+///                                          represented number is negative.
 double SFromCLI(char** argv) {
-  MALIPUT_DEMAND(argv != nullptr);
+  MALIPUT_THROW_UNLESS(argv != nullptr);
   const double s = std::strtod(argv[0], nullptr);
   MALIPUT_THROW_UNLESS(s >= 0.);
   return s;
 }
 
-int Main(int argc, char* argv[]) {
-  gflags::SetUsageMessage(GetUsageMessage());
-  gflags::ParseCommandLineFlags(&argc, &argv, true);
+// @returns A unique id for the objects the commands create, so that several commands can run against the same
+// RoadNetworkQuery.
+std::string NextObjectId() {
+  static int num_objects{0};
+  return "Box_" + std::to_string(++num_objects);
+}
+
+// Keeps objects in a ManualObjectBook while it is alive, so that the book doesn't grow with every command that creates
+// objects when many of them run against the same RoadNetworkQuery.
+class ScopedObjects {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedObjects)
+  ScopedObjects() = delete;
+
+  // Constructs a ScopedObjects.
+  // @param object_book The book to add the objects to. It must not be nullptr.
+  explicit ScopedObjects(maliput::object::ManualObjectBook<maliput::math::Vector3>* object_book)
+      : object_book_(object_book) {
+    MALIPUT_THROW_UNLESS(object_book_ != nullptr);
+  }
+
+  // Removes the added objects from the book.
+  ~ScopedObjects() {
+    for (const maliput::object::api::Object<maliput::math::Vector3>::Id& id : ids_) {
+      object_book_->RemoveObject(id);
+    }
+  }
+
+  // Adds @p object to the book.
+  // @returns A pointer to @p object, valid while this instance is alive.
+  const maliput::object::api::Object<maliput::math::Vector3>* Add(
+      std::unique_ptr<maliput::object::api::Object<maliput::math::Vector3>> object) {
+    const maliput::object::api::Object<maliput::math::Vector3>* object_ptr = object.get();
+    ids_.push_back(object_ptr->id());
+    object_book_->AddObject(std::move(object));
+    return object_ptr;
+  }
+
+ private:
+  maliput::object::ManualObjectBook<maliput::math::Vector3>* object_book_{};
+  std::vector<maliput::object::api::Object<maliput::math::Vector3>::Id> ids_;
+};
+
+// Validates that @p argv holds a known command followed by the right number of arguments.
+// `argv[0]` is ignored and `argv[1]` is the command name.
+// @returns The Command, or std::nullopt when it is not valid. Errors are logged.
+std::optional<Command> ParseCommand(int argc, char** argv) {
   if (argc < 2) {
     maliput::log()->error("Not valid command provided.\nRun 'maliput_query --help' for help.\n");
-    return 1;
+    return std::nullopt;
   }
   const auto commands_usage = CommandsUsage();
   const auto command_it = commands_usage.find(argv[1]);
   if (command_it == commands_usage.end()) {
     maliput::log()->error("Not valid command provided: {}\nRun 'maliput_query --help' for help.\n", argv[1]);
-    return 1;
+    return std::nullopt;
   }
   const Command command = command_it->second;
   if (argc != command.num_arguments + 1) {
     maliput::log()->error("Missing arguments for command: {}\nRun 'maliput_query --help' for help.\n", command.usage);
-    return 1;
+    return std::nullopt;
   }
+  return command;
+}
 
-  maliput::common::set_log_level(FLAGS_log_level);
-
-  // Commands that not require a road network.
+// Runs @p command when it doesn't require a road network.
+// @returns True when @p command doesn't require a road network.
+bool RunCommandWithoutRoadNetwork(const Command& command, char** argv) {
   if (command.name.compare("GetMaliputBackendList") == 0) {
     GetMaliputBackendList(&std::cout);
-    return 0;
+    return true;
   } else if (command.name.compare("GetMaliputBackendParameters") == 0) {
     const std::string backend_name = argv[2];
     GetMaliputBackendParameters(backend_name, &std::cout);
-    return 0;
+    return true;
   }
+  return false;
+}
 
-  // Loads a road network.
-  log()->info("Loading road network using {} backend implementation...", FLAGS_maliput_backend);
-  const MaliputImplementation maliput_implementation{StringToMaliputImplementation(FLAGS_maliput_backend)};
-  auto rn = LoadRoadNetwork(
-      maliput_implementation,
-      {FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width, FLAGS_shoulder_width, FLAGS_maximum_height}, {FLAGS_yaml_file},
-      {FLAGS_xodr_file_path, GetLinearToleranceFlag(), GetMaxLinearToleranceFlag(), FLAGS_build_policy,
-       FLAGS_num_threads, FLAGS_simplification_policy, FLAGS_standard_strictness_policy, FLAGS_omit_nondrivable_lanes,
-       FLAGS_rule_registry_file, FLAGS_road_rule_book_file, FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file,
-       FLAGS_intersection_book_file},
-      {FLAGS_osm_file, FLAGS_linear_tolerance, FLAGS_angular_tolerance, maliput::math::Vector2::FromStr(FLAGS_origin),
-       FLAGS_rule_registry_file, FLAGS_road_rule_book_file, FLAGS_traffic_light_book_file, FLAGS_phase_ring_book_file,
-       FLAGS_intersection_book_file});
-  MALIPUT_DEMAND(rn != nullptr);
-  log()->info("RoadNetwork loaded successfully.");
-
-  auto rn_ptr = rn.get();
-  RoadNetworkQuery query(&std::cout, const_cast<maliput::api::RoadNetwork*>(rn_ptr));
-
-  // Commands that require a road network.
+// Runs @p command, whose arguments are held by @p argv as described in ParseCommand(), against @p query.
+void RunCommand(const Command& command, char** argv, RoadNetworkQuery* query) {
+  if (RunCommandWithoutRoadNetwork(command, argv)) {
+    return;
+  }
   if (command.name.compare("FindRoadPositions") == 0) {
     const maliput::api::InertialPosition inertial_position = InertialPositionFromCLI(&(argv[2]));
     const double radius = RadiusFromCLI(&(argv[5]));
 
-    query.FindRoadPositions(inertial_position, radius);
+    query->FindRoadPositions(inertial_position, radius);
   } else if (command.name.compare("ToRoadPosition") == 0) {
     const maliput::api::InertialPosition inertial_position = InertialPositionFromCLI(&(argv[2]));
 
-    query.ToRoadPosition(inertial_position);
+    query->ToRoadPosition(inertial_position);
+  } else if (command.name.compare("ToRoadPositionBatch") == 0) {
+    const std::string file_path = argv[2];
+
+    query->ToRoadPositionBatch(file_path);
   } else if (command.name.compare("ToLanePosition") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
     const maliput::api::InertialPosition inertial_position = InertialPositionFromCLI(&(argv[3]));
 
-    query.ToLanePosition(lane_id, inertial_position);
+    query->ToLanePosition(lane_id, inertial_position);
   } else if (command.name.compare("ToSegmentPosition") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
     const maliput::api::InertialPosition inertial_position = InertialPositionFromCLI(&(argv[3]));
 
-    query.ToSegmentPosition(lane_id, inertial_position);
+    query->ToSegmentPosition(lane_id, inertial_position);
   } else if (command.name.compare("GetOrientation") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
     const maliput::api::LanePosition lane_position = LanePositionFromCLI(&(argv[3]));
 
-    query.GetOrientation(lane_id, lane_position);
+    query->GetOrientation(lane_id, lane_position);
   } else if (command.name.compare("ToInertialPosition") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
     const maliput::api::LanePosition lane_position = LanePositionFromCLI(&(argv[3]));
 
-    query.ToInertialPosition(lane_id, lane_position);
+    query->ToInertialPosition(lane_id, lane_position);
   } else if (command.name.compare("GetConfluentBranches") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
     const maliput::api::LaneEnd::Which which = LaneEndWhichFromCLI(&(argv[3]));
 
-    query.GetConfluentBranches(lane_id, which);
+    query->GetConfluentBranches(lane_id, which);
   } else if (command.name.compare("GetOngoingBranches") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
     const maliput::api::LaneEnd::Which which = LaneEndWhichFromCLI(&(argv[3]));
 
-    query.GetOngoingBranches(lane_id, which);
+    query->GetOngoingBranches(lane_id, which);
   } else if (command.name.compare("GetMaxSpeedLimit") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
 
-    query.GetMaxSpeedLimit(lane_id);
+    query->GetMaxSpeedLimit(lane_id);
   } else if (command.name.compare("GetDirectionUsage") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
 
-    query.GetDirectionUsage(lane_id);
+    query->GetDirectionUsage(lane_id);
   } else if (command.name.compare("GetRightOfWay") == 0) {
     const maliput::api::LaneSRange lane_s_range = LaneSRangeFromCLI(&(argv[2]));
 
-    query.GetRightOfWay(lane_s_range);
+    query->GetRightOfWay(lane_s_range);
   } else if (command.name.compare("GetPhaseRightOfWay") == 0) {
     const maliput::api::rules::PhaseRing::Id phase_ring_id = PhaseRingIdFromCLI(&(argv[2]));
     const maliput::api::rules::Phase::Id phase_id = PhaseIdFromCLI(&(argv[3]));
 
-    query.GetPhaseRightOfWay(phase_ring_id, phase_id);
+    query->GetPhaseRightOfWay(phase_ring_id, phase_id);
   } else if (command.name.compare("GetDiscreteValueRules") == 0) {
     const maliput::api::LaneSRange lane_s_range = LaneSRangeFromCLI(&(argv[2]));
 
-    query.GetDiscreteValueRule(lane_s_range);
+    query->GetDiscreteValueRule(lane_s_range);
   } else if (command.name.compare("GetRangeValueRules") == 0) {
     const maliput::api::LaneSRange lane_s_range = LaneSRangeFromCLI(&(argv[2]));
 
-    query.GetRangeValueRule(lane_s_range);
+    query->GetRangeValueRule(lane_s_range);
   } else if (command.name.compare("GetLaneBounds") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
     const double s = SFromCLI(&(argv[3]));
 
-    query.GetLaneBounds(lane_id, s);
+    query->GetLaneBounds(lane_id, s);
   } else if (command.name.compare("GetSegmentBounds") == 0) {
     const maliput::api::SegmentId segment_id = SegmentIdFromCLI(&(argv[2]));
     const double s = SFromCLI(&(argv[3]));
 
-    query.GetSegmentBounds(segment_id, s);
+    query->GetSegmentBounds(segment_id, s);
   } else if (command.name.compare("GetLaneLength") == 0) {
     const maliput::api::LaneId lane_id = LaneIdFromCLI(&(argv[2]));
 
-    query.GetLaneLength(lane_id);
+    query->GetLaneLength(lane_id);
   } else if (command.name.compare("GetNumberOfLanes") == 0) {
-    query.GetNumberOfLanes();
+    query->GetNumberOfLanes();
 
   } else if (command.name.compare("FindOverlappingLanesIn") == 0) {
     const maliput::math::OverlappingType overlapping_type = OverlappingTypeFromCLI(&(argv[2]));
-    std::unique_ptr<maliput::object::api::Object<maliput::math::Vector3>> bounding_object =
-        ObjectFromCLI(std::string{"Box_1"}, &(argv[3]));
-    const maliput::object::api::Object<maliput::math::Vector3>* bounding_object_ptr = bounding_object.get();
-    query.GetManualObjectBook()->AddObject(std::move(bounding_object));
-    query.FindOverlappingLanesIn(bounding_object_ptr, overlapping_type);
+    ScopedObjects objects(query->GetManualObjectBook());
+    const maliput::object::api::Object<maliput::math::Vector3>* bounding_object_ptr =
+        objects.Add(ObjectFromCLI(NextObjectId(), &(argv[3])));
+    query->FindOverlappingLanesIn(bounding_object_ptr, overlapping_type);
 
   } else if (command.name.compare("Route") == 0) {
-    std::unique_ptr<maliput::object::api::Object<maliput::math::Vector3>> bounding_object_1 =
-        ObjectFromCLI(std::string{"Box_1"}, &(argv[3]));
-    std::unique_ptr<maliput::object::api::Object<maliput::math::Vector3>> bounding_object_2 =
-        ObjectFromCLI(std::string{"Box_2"}, &(argv[3]));
-    const maliput::object::api::Object<maliput::math::Vector3>* bounding_object_ptr_1 = bounding_object_1.get();
-    const maliput::object::api::Object<maliput::math::Vector3>* bounding_object_ptr_2 = bounding_object_2.get();
-    query.GetManualObjectBook()->AddObject(std::move(bounding_object_1));
-    query.GetManualObjectBook()->AddObject(std::move(bounding_object_2));
-    query.Route(bounding_object_ptr_1, bounding_object_ptr_2);
-  }
-
-  return 0;
+    ScopedObjects objects(query->GetManualObjectBook());
+    const maliput::object::api::Object<maliput::math::Vector3>* bounding_object_ptr_1 =
+        objects.Add(ObjectFromCLI(NextObjectId(), &(argv[3])));
+    const maliput::object::api::Object<maliput::math::Vector3>* bounding_object_ptr_2 =
+        objects.Add(ObjectFromCLI(NextObjectId(), &(argv[3])));
+    query->Route(bounding_object_ptr_1, bounding_object_ptr_2);
+  }
+}
+
+// Counters of the commands run by RunCommands().
+struct BatchResult {
+  int num_commands{0};
+  int num_failed_commands{0};
+  // Wall time in seconds.
+  double duration{0.};
+};
+
+// Runs the commands read from @p in against @p query. Commands are given one per line with the same syntax as in the
+// command line, i.e. `<command> <arg1> <arg2> ... <argN>`. Empty lines and lines starting with `#` are skipped.
+// Commands that are not valid or that throw are logged and counted as failed, the rest of the commands still run.
+BatchResult RunCommands(std::istream* in, RoadNetworkQuery* query) {
+  BatchResult result;
+  const auto start = std::chrono::high_resolution_clock::now();
+  std::string line;
+  int line_number{0};
+  while (std::getline(*in, line)) {
+    ++line_number;
+    std::istringstream line_stream(line);
+    // The first token emulates the program name, so the arguments are laid out as in the command line.
+    std::vector<std::string> tokens{"maliput_query"};
+    for (std::string token; line_stream >> token;) {
+      tokens.push_back(token);
+    }
+    if (tokens.size() == 1 || tokens[1].front() == '#') {
+      continue;
+    }
+    ++result.num_commands;
+    std::vector<char*> argv;
+    for (std::string& token : tokens) {
+      argv.push_back(token.data());
+    }
+    const std::optional<Command> command = ParseCommand(static_cast<int>(argv.size()), argv.data());
+    if (!command.has_value()) {
+      maliput::log()->error("Line {}: '{}' could not be parsed.", line_number, line);
+      ++result.num_failed_commands;
+      continue;
+    }
+    try {
+      RunCommand(command.value(), argv.data(), query);
+    } catch (const std::exception& e) {
+      maliput::log()->error("Line {}: '{}' failed: {}", line_number, line, e.what());
+      ++result.num_failed_commands;
+    }
+  }
+  const auto end = std::chrono::high_resolution_clock::now();
+  result.duration = std::chrono::duration<double>(end - start).count();
+  return result;
+}
+
+// Writes the latency histograms of @p query to @p latency_file, the file given by --latency_json. Nothing is written
+// when it is nullptr.
+// @returns False when the file could not be written.
+bool WriteLatencyJson(const RoadNetworkQuery& query, std::ofstream* latency_file) {
+  if (latency_file == nullptr) {
+    return true;
+  }
+  JsonWriter writer(latency_file);
+  WriteLatencyHistograms(query.latency_histograms(), &writer);
+  (*latency_file) << std::endl;
+  if (!latency_file->good()) {
+    maliput::log()->error("Latency file: {} could not be written.\n", FLAGS_latency_json);
+    return false;
+  }
+  return true;
+}
+
+int Main(int argc, char* argv[]) {
+  gflags::SetUsageMessage(GetUsageMessage());
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  const bool batch_mode = !FLAGS_commands_file.empty();
+  std::optional<Command> command;
+  if (batch_mode) {
+    if (argc > 1) {
+      maliput::log()->error("No command must be provided along with --commands_file.\n");
+      return 1;
+    }
+  } else {
+    command = ParseCommand(argc, argv);
+    if (!command.has_value()) {
+      return 1;
+    }
+  }
+
+  maliput::common::set_log_level(FLAGS_log_level);
+
+  // Commands that not require a road network.
+  if (!batch_mode && RunCommandWithoutRoadNetwork(command.value(), argv)) {
+    return 0;
+  }
+
+  std::ifstream commands_file;
+  if (batch_mode && FLAGS_commands_file != "-") {
+    commands_file.open(FLAGS_commands_file);
+    if (!commands_file.is_open()) {
+      maliput::log()->error("Commands file: {} could not be opened.\n", FLAGS_commands_file);
+      return 1;
+    }
+  }
+  if (FLAGS_output_format != "text" && FLAGS_output_format != "json") {
+    maliput::log()->error("Unknown output format: {}. Use 'text' or 'json'.\n", FLAGS_output_format);
+    return 1;
+  }
+  // Opened before the load starts, as the load can't be interrupted once it started.
+  std::unique_ptr<std::ofstream> latency_file;
+  if (!FLAGS_latency_json.empty()) {
+    latency_file = std::make_unique<std::ofstream>(FLAGS_latency_json);
+    if (!latency_file->is_open()) {
+      maliput::log()->error("Latency file: {} could not be opened.\n", FLAGS_latency_json);
+      return 1;
+    }
+  }
+
+  // Loads a road network.
+  log()->info("Loading road network using {} backend implementation...", FLAGS_maliput_backend);
+  RoadNetworkDescriptor descriptor;
+  descriptor.maliput_implementation = StringToMaliputImplementation(FLAGS_maliput_backend);
+  descriptor.dragway_build_properties = {FLAGS_num_lanes, FLAGS_length, FLAGS_lane_width, FLAGS_shoulder_width,
+                                         FLAGS_maximum_height};
+  descriptor.multilane_build_properties = {FLAGS_yaml_file};
+  descriptor.malidrive_build_properties = {FLAGS_xodr_file_path,
+                                           GetLinearToleranceFlag(),
+                                           GetMaxLinearToleranceFlag(),
+                                           FLAGS_build_policy,
+                                           FLAGS_num_threads,
+                                           FLAGS_simplification_policy,
+                                           FLAGS_standard_strictness_policy,
+                                           FLAGS_omit_nondrivable_lanes,
+                                           FLAGS_rule_registry_file,
+                                           FLAGS_road_rule_book_file,
+                                           FLAGS_traffic_light_book_file,
+                                           FLAGS_phase_ring_book_file,
+                                           FLAGS_intersection_book_file};
+  descriptor.maliput_osm_build_properties = {FLAGS_osm_file,
+                                             FLAGS_linear_tolerance,
+                                             FLAGS_angular_tolerance,
+                                             maliput::math::Vector2::FromStr(FLAGS_origin),
+                                             FLAGS_rule_registry_file,
+                                             FLAGS_road_rule_book_file,
+                                             FLAGS_traffic_light_book_file,
+                                             FLAGS_phase_ring_book_file,
+                                             FLAGS_intersection_book_file};
+  // The road network is built in the background; its progress is logged until it is ready.
+  AsyncRoadNetworkLoader loader(descriptor);
+  // Work that doesn't need the road network is done while it loads.
+  std::unique_ptr<ThreadPool> overlapping_thread_pool;
+  if (FLAGS_overlapping_threads > 0) {
+    overlapping_thread_pool = std::make_unique<ThreadPool>(FLAGS_overlapping_threads);
+  }
+  while (!loader.WaitFor(kLoadProgressPeriod)) {
+    log()->info("Loading road network... {} s elapsed.", loader.elapsed());
+  }
+  auto rn = loader.Get();
+  MALIPUT_DEMAND(rn != nullptr);
+  log()->info("RoadNetwork loaded successfully.");
+
+  auto rn_ptr = rn.get();
+  RoadNetworkQuery query(&std::cout, const_cast<maliput::api::RoadNetwork*>(rn_ptr));
+  if (FLAGS_output_format == "json") {
+    query.EnableJsonOutput();
+  }
+  if (FLAGS_spatial_index || FLAGS_spatial_index_compare) {
+    query.EnableSpatialIndex(FLAGS_spatial_index_compare);
+  }
+  if (overlapping_thread_pool != nullptr) {
+    query.EnableParallelOverlapping(std::move(overlapping_thread_pool));
+  }
+
+  if (!batch_mode) {
+    try {
+      RunCommand(command.value(), argv, &query);
+    } catch (const std::exception& e) {
+      maliput::log()->error("{} failed: {}\nRun 'maliput_query --help' for help.\n", command->name, e.what());
+      return 1;
+    }
+    return WriteLatencyJson(query, latency_file.get()) ? 0 : 1;
+  }
+
+  std::istream* in = FLAGS_commands_file == "-" ? &std::cin : &commands_file;
+  const BatchResult result = RunCommands(in, &query);
+  if (query.json_output()) {
+    // The standard output only holds results, so the summary is logged instead. Latencies can be written to a file
+    // with --latency_json.
+    maliput::log()->info("Executed {} commands ({} failed) in {} s.", result.num_commands, result.num_failed_commands,
+                         result.duration);
+    return WriteLatencyJson(query, latency_file.get()) && result.num_failed_commands == 0 ? 0 : 1;
+  }
+  std::cout << "Executed " << result.num_commands << " commands (" << result.num_failed_commands << " failed) in "
+            << result.duration << " s";
+  if (result.duration > 0.) {
+    std::cout << ": " << result.num_commands / result.duration << " commands/s";
+  }
+  std::cout << std::endl;
+  query.PrintLatencySummary();
+  return WriteLatencyJson(query, latency_file.get()) && result.num_failed_commands == 0 ? 0 : 1;
 }
 
 }  // namespace
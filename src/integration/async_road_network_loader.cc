@@ -0,0 +1,177 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/async_road_network_loader.h"
+
+#include <utility>
+
+#include <maliput/common/logger.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+AsyncRoadNetworkLoader::AsyncRoadNetworkLoader(const RoadNetworkDescriptor& descriptor, OnDoneCallback on_done)
+    : on_done_(std::move(on_done)) {
+  thread_ = std::thread(&AsyncRoadNetworkLoader::Load, this, descriptor);
+}
+
+AsyncRoadNetworkLoader::~AsyncRoadNetworkLoader() {
+  Cancel();
+  thread_.join();
+}
+
+AsyncRoadNetworkLoader::Status AsyncRoadNetworkLoader::status() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return status_;
+}
+
+double AsyncRoadNetworkLoader::elapsed() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (status_ == Status::kPending) {
+    return 0.;
+  }
+  const std::chrono::steady_clock::time_point end = IsDone(status_) ? end_ : std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start_).count();
+}
+
+std::string AsyncRoadNetworkLoader::error() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return error_message_;
+}
+
+bool AsyncRoadNetworkLoader::Cancel() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (IsDone(status_)) {
+    return false;
+  }
+  cancel_requested_ = true;
+  return true;
+}
+
+void AsyncRoadNetworkLoader::Wait() const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this]() { return IsDone(status_); });
+}
+
+bool AsyncRoadNetworkLoader::WaitFor(double timeout) const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return condition_.wait_for(lock, std::chrono::duration<double>(timeout), [this]() { return IsDone(status_); });
+}
+
+std::unique_ptr<api::RoadNetwork> AsyncRoadNetworkLoader::Get() {
+  Wait();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (status_ == Status::kFailed) {
+    std::rethrow_exception(error_);
+  }
+  if (status_ == Status::kCancelled) {
+    MALIPUT_THROW_MESSAGE("The RoadNetwork load was cancelled.");
+  }
+  if (taken_) {
+    MALIPUT_THROW_MESSAGE("The RoadNetwork was already taken.");
+  }
+  taken_ = true;
+  return std::move(road_network_);
+}
+
+bool AsyncRoadNetworkLoader::IsDone(Status status) {
+  return status == Status::kReady || status == Status::kFailed || status == Status::kCancelled;
+}
+
+void AsyncRoadNetworkLoader::Load(const RoadNetworkDescriptor& descriptor) {
+  bool skip{false};
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    start_ = std::chrono::steady_clock::now();
+    skip = cancel_requested_;
+    if (!skip) {
+      status_ = Status::kLoading;
+    }
+  }
+
+  std::unique_ptr<api::RoadNetwork> road_network;
+  std::exception_ptr error;
+  std::string error_message;
+  if (!skip) {
+    try {
+      road_network =
+          LoadRoadNetwork(descriptor.maliput_implementation, descriptor.dragway_build_properties,
+                          descriptor.multilane_build_properties, descriptor.malidrive_build_properties,
+                          descriptor.maliput_osm_build_properties);
+    } catch (const std::exception& e) {
+      error = std::current_exception();
+      error_message = e.what();
+    } catch (...) {
+      error = std::current_exception();
+      error_message = "Unknown error.";
+    }
+  }
+
+  Status status{Status::kReady};
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    end_ = std::chrono::steady_clock::now();
+    if (cancel_requested_) {
+      status = Status::kCancelled;
+    } else if (error != nullptr) {
+      status = Status::kFailed;
+      error_ = error;
+      error_message_ = error_message;
+    } else {
+      road_network_ = std::move(road_network);
+    }
+    status_ = status;
+  }
+  condition_.notify_all();
+  maliput::log()->debug("RoadNetwork load finished with status {} after {} s.",
+                        AsyncRoadNetworkLoaderStatusToString(status), elapsed());
+  if (on_done_ != nullptr) {
+    on_done_(status);
+  }
+}
+
+std::string AsyncRoadNetworkLoaderStatusToString(AsyncRoadNetworkLoader::Status status) {
+  switch (status) {
+    case AsyncRoadNetworkLoader::Status::kPending:
+      return "pending";
+    case AsyncRoadNetworkLoader::Status::kLoading:
+      return "loading";
+    case AsyncRoadNetworkLoader::Status::kReady:
+      return "ready";
+    case AsyncRoadNetworkLoader::Status::kFailed:
+      return "failed";
+    case AsyncRoadNetworkLoader::Status::kCancelled:
+      return "cancelled";
+  }
+  MALIPUT_THROW_MESSAGE("Unknown AsyncRoadNetworkLoader::Status value.");
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,139 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <maliput/api/road_network.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+
+/// Builds an api::RoadNetwork on a background thread.
+///
+/// The build starts on construction, so the caller can carry on with other work (parsing arguments, setting up the
+/// output, answering health checks, etc.) and collect the api::RoadNetwork with Get() once it is needed. Progress is
+/// exposed via status() and elapsed(), and completion is notified via Wait(), WaitFor() and an optional callback.
+///
+/// Cancellation is cooperative: backends can't be interrupted once they started building, so a Cancel() issued while
+/// loading lets the build finish and discards its result. A Cancel() issued before the build starts skips it.
+///
+/// The destructor cancels the load and waits for the background thread to finish.
+class AsyncRoadNetworkLoader {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncRoadNetworkLoader)
+
+  /// Status of the load.
+  enum class Status {
+    kPending,    ///< The build hasn't started yet.
+    kLoading,    ///< The build is in progress.
+    kReady,      ///< The api::RoadNetwork was built successfully.
+    kFailed,     ///< The build threw an exception.
+    kCancelled,  ///< The load was cancelled.
+  };
+
+  /// Callback invoked from the background thread once the load reaches its final status: kReady, kFailed or
+  /// kCancelled.
+  using OnDoneCallback = std::function<void(Status)>;
+
+  AsyncRoadNetworkLoader() = delete;
+
+  /// Constructs an AsyncRoadNetworkLoader and starts the build.
+  /// @param descriptor Describes the api::RoadNetwork to build.
+  /// @param on_done Optional callback to invoke once the load is done. It could be nullptr.
+  explicit AsyncRoadNetworkLoader(const RoadNetworkDescriptor& descriptor, OnDoneCallback on_done = nullptr);
+
+  ~AsyncRoadNetworkLoader();
+
+  /// @returns The current Status.
+  Status status() const;
+
+  /// @returns The time in seconds spent building, or zero when the build hasn't started. It stops increasing once the
+  ///          build is done.
+  double elapsed() const;
+
+  /// @returns The description of the error when the status is kFailed, otherwise an empty string.
+  std::string error() const;
+
+  /// Requests the load to be cancelled.
+  /// @returns True when the load was not done yet, so it will end up kCancelled.
+  bool Cancel();
+
+  /// Blocks until the load is done.
+  void Wait() const;
+
+  /// Blocks until the load is done or `timeout` seconds elapse.
+  /// @returns True when the load is done.
+  bool WaitFor(double timeout) const;
+
+  /// Blocks until the load is done and takes the built api::RoadNetwork. It can only be taken once.
+  /// @returns The built api::RoadNetwork.
+  ///
+  /// @throw The exception thrown by the build when the status is kFailed.
+  /// @throw maliput::common::assertion_error When the load was cancelled or the api::RoadNetwork was already taken.
+  std::unique_ptr<api::RoadNetwork> Get();
+
+ private:
+  // @returns True when @p status is final.
+  static bool IsDone(Status status);
+
+  // Builds the api::RoadNetwork described by @p descriptor. It runs on the background thread.
+  void Load(const RoadNetworkDescriptor& descriptor);
+
+  const OnDoneCallback on_done_;
+  mutable std::mutex mutex_;
+  mutable std::condition_variable condition_;
+  std::atomic<bool> cancel_requested_{false};
+  Status status_{Status::kPending};
+  std::chrono::steady_clock::time_point start_;
+  std::chrono::steady_clock::time_point end_;
+  std::unique_ptr<api::RoadNetwork> road_network_;
+  std::exception_ptr error_;
+  std::string error_message_;
+  bool taken_{false};
+  std::thread thread_;
+};
+
+/// @returns The std::string version of `status`.
+std::string AsyncRoadNetworkLoaderStatusToString(AsyncRoadNetworkLoader::Status status);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,178 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/json_serialization.h"
+
+#include <maliput/api/lane.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/roll_pitch_yaw.h>
+
+namespace maliput {
+namespace integration {
+
+void WriteJson(const api::InertialPosition& inertial_position, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject();
+  writer->Key("x").Value(inertial_position.x());
+  writer->Key("y").Value(inertial_position.y());
+  writer->Key("z").Value(inertial_position.z());
+  writer->EndObject();
+}
+
+void WriteJson(const api::LanePosition& lane_position, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject();
+  writer->Key("s").Value(lane_position.s());
+  writer->Key("r").Value(lane_position.r());
+  writer->Key("h").Value(lane_position.h());
+  writer->EndObject();
+}
+
+void WriteJson(const api::RoadPosition& road_position, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("lane_id");
+  if (road_position.lane != nullptr) {
+    writer->Value(road_position.lane->id().string());
+  } else {
+    writer->Null();
+  }
+  writer->Key("lane_position");
+  WriteJson(road_position.pos, writer);
+  writer->EndObject();
+}
+
+void WriteJson(const api::RoadPositionResult& result, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("road_position");
+  WriteJson(result.road_position, writer);
+  writer->Key("nearest_position");
+  WriteJson(result.nearest_position, writer);
+  writer->Key("distance").Value(result.distance);
+  writer->EndObject();
+}
+
+void WriteJson(const api::LanePositionResult& result, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("lane_position");
+  WriteJson(result.lane_position, writer);
+  writer->Key("nearest_position");
+  WriteJson(result.nearest_position, writer);
+  writer->Key("distance").Value(result.distance);
+  writer->EndObject();
+}
+
+void WriteJson(const api::Rotation& rotation, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  const math::RollPitchYaw rpy = rotation.rpy();
+  writer->StartObject();
+  writer->Key("roll").Value(rpy.roll_angle());
+  writer->Key("pitch").Value(rpy.pitch_angle());
+  writer->Key("yaw").Value(rpy.yaw_angle());
+  writer->EndObject();
+}
+
+void WriteJson(const api::RBounds& r_bounds, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("min").Value(r_bounds.min()).Key("max").Value(r_bounds.max()).EndObject();
+}
+
+void WriteJson(const api::LaneEnd& lane_end, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  MALIPUT_THROW_UNLESS(lane_end.lane != nullptr);
+  writer->StartObject();
+  writer->Key("lane_id").Value(lane_end.lane->id().string());
+  writer->Key("end").Value(lane_end.end == api::LaneEnd::kStart ? "start" : "finish");
+  writer->EndObject();
+}
+
+void WriteJson(const api::SRange& s_range, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("s0").Value(s_range.s0()).Key("s1").Value(s_range.s1()).EndObject();
+}
+
+void WriteJson(const api::LaneSRange& lane_s_range, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("lane_id").Value(lane_s_range.lane_id().string()).Key("s_range");
+  WriteJson(lane_s_range.s_range(), writer);
+  writer->EndObject();
+}
+
+void WriteJson(const api::LaneSRoute& lane_s_route, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartArray();
+  for (const api::LaneSRange& lane_s_range : lane_s_route.ranges()) {
+    WriteJson(lane_s_range, writer);
+  }
+  writer->EndArray();
+}
+
+void WriteJson(const api::rules::SpeedLimitRule& rule, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("id").Value(rule.id().string()).Key("zone");
+  WriteJson(rule.zone(), writer);
+  writer->Key("severity").Value(rule.severity() == api::rules::SpeedLimitRule::Severity::kStrict ? "strict"
+                                                                                                  : "advisory");
+  writer->Key("min").Value(rule.min());
+  writer->Key("max").Value(rule.max());
+  writer->EndObject();
+}
+
+void WriteJson(const api::rules::Rule::RelatedRules& related_rules, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject();
+  for (const auto& group_rule_ids : related_rules) {
+    writer->Key(group_rule_ids.first).StartArray();
+    for (const api::rules::Rule::Id& rule_id : group_rule_ids.second) {
+      writer->Value(rule_id.string());
+    }
+    writer->EndArray();
+  }
+  writer->EndObject();
+}
+
+void WriteJson(const api::rules::DiscreteValueRule::DiscreteValue& discrete_value, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("severity").Value(discrete_value.severity).Key("related_rules");
+  WriteJson(discrete_value.related_rules, writer);
+  writer->Key("value").Value(discrete_value.value);
+  writer->EndObject();
+}
+
+void WriteJson(const api::rules::RangeValueRule::Range& range, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject().Key("severity").Value(range.severity).Key("related_rules");
+  WriteJson(range.related_rules, writer);
+  writer->Key("description").Value(range.description);
+  writer->Key("min").Value(range.min);
+  writer->Key("max").Value(range.max);
+  writer->EndObject();
+}
+
+}  // namespace integration
+}  // namespace maliput
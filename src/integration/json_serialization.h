@@ -0,0 +1,108 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/range_value_rule.h>
+#include <maliput/api/rules/rule.h>
+#include <maliput/api/rules/speed_limit_rule.h>
+
+#include "integration/json_writer.h"
+
+namespace maliput {
+namespace integration {
+
+/// @defgroup json_serialization JSON serialization of maliput types.
+///
+/// Each overload writes a single JSON value, usually an object with a member per field, to a JsonWriter. Identifiers
+/// are written as strings and enumerations as their lowercase names. They can be nested into any document:
+///
+/// @code{cpp}
+/// JsonWriter writer(&std::cout);
+/// writer.StartObject().Key("result");
+/// WriteJson(road_position_result, &writer);
+/// writer.EndObject();
+/// @endcode
+///
+/// All of them throw maliput::common::assertion_error when `writer` is nullptr.
+/// @{
+
+/// Writes `inertial_position` as `{"x":x,"y":y,"z":z}`.
+void WriteJson(const api::InertialPosition& inertial_position, JsonWriter* writer);
+
+/// Writes `lane_position` as `{"s":s,"r":r,"h":h}`.
+void WriteJson(const api::LanePosition& lane_position, JsonWriter* writer);
+
+/// Writes `road_position` as `{"lane_id":id,"lane_position":{...}}`, where `lane_id` is `null` when the lane is not
+/// set.
+void WriteJson(const api::RoadPosition& road_position, JsonWriter* writer);
+
+/// Writes `result` as `{"road_position":{...},"nearest_position":{...},"distance":distance}`.
+void WriteJson(const api::RoadPositionResult& result, JsonWriter* writer);
+
+/// Writes `result` as `{"lane_position":{...},"nearest_position":{...},"distance":distance}`.
+void WriteJson(const api::LanePositionResult& result, JsonWriter* writer);
+
+/// Writes `rotation` as `{"roll":roll,"pitch":pitch,"yaw":yaw}`.
+void WriteJson(const api::Rotation& rotation, JsonWriter* writer);
+
+/// Writes `r_bounds` as `{"min":min,"max":max}`.
+void WriteJson(const api::RBounds& r_bounds, JsonWriter* writer);
+
+/// Writes `lane_end` as `{"lane_id":id,"end":"start"|"finish"}`.
+void WriteJson(const api::LaneEnd& lane_end, JsonWriter* writer);
+
+/// Writes `s_range` as `{"s0":s0,"s1":s1}`.
+void WriteJson(const api::SRange& s_range, JsonWriter* writer);
+
+/// Writes `lane_s_range` as `{"lane_id":id,"s_range":{...}}`.
+void WriteJson(const api::LaneSRange& lane_s_range, JsonWriter* writer);
+
+/// Writes `lane_s_route` as an array of its api::LaneSRanges.
+void WriteJson(const api::LaneSRoute& lane_s_route, JsonWriter* writer);
+
+/// Writes `rule` as `{"id":id,"zone":{...},"severity":"strict"|"advisory","min":min,"max":max}`.
+void WriteJson(const api::rules::SpeedLimitRule& rule, JsonWriter* writer);
+
+/// Writes `related_rules` as an object whose members are the groups, holding arrays of rule ids.
+void WriteJson(const api::rules::Rule::RelatedRules& related_rules, JsonWriter* writer);
+
+/// Writes `discrete_value` as `{"severity":severity,"related_rules":{...},"value":value}`.
+void WriteJson(const api::rules::DiscreteValueRule::DiscreteValue& discrete_value, JsonWriter* writer);
+
+/// Writes `range` as `{"severity":severity,"related_rules":{...},"description":description,"min":min,"max":max}`.
+void WriteJson(const api::rules::RangeValueRule::Range& range, JsonWriter* writer);
+
+/// @}
+
+}  // namespace integration
+}  // namespace maliput
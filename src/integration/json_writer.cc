@@ -0,0 +1,178 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/json_writer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Writes @p value as a quoted and escaped JSON string into @p out.
+void WriteString(const std::string& value, std::ostream* out) {
+  (*out) << '"';
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        (*out) << "\\\"";
+        break;
+      case '\\':
+        (*out) << "\\\\";
+        break;
+      case '\n':
+        (*out) << "\\n";
+        break;
+      case '\r':
+        (*out) << "\\r";
+        break;
+      case '\t':
+        (*out) << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[7];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+          (*out) << buffer;
+        } else {
+          (*out) << c;
+        }
+        break;
+    }
+  }
+  (*out) << '"';
+}
+
+}  // namespace
+
+JsonWriter::JsonWriter(std::ostream* out) : out_(out) { MALIPUT_THROW_UNLESS(out_ != nullptr); }
+
+void JsonWriter::BeginElement() {
+  if (after_key_) {
+    after_key_ = false;
+    return;
+  }
+  if (!first_element_.empty()) {
+    if (!first_element_.back()) {
+      (*out_) << ',';
+    }
+    first_element_.back() = false;
+  }
+}
+
+JsonWriter& JsonWriter::StartObject() {
+  BeginElement();
+  (*out_) << '{';
+  first_element_.push_back(true);
+  return *this;
+}
+
+JsonWriter& JsonWriter::EndObject() {
+  MALIPUT_THROW_UNLESS(!first_element_.empty());
+  first_element_.pop_back();
+  (*out_) << '}';
+  return *this;
+}
+
+JsonWriter& JsonWriter::StartArray() {
+  BeginElement();
+  (*out_) << '[';
+  first_element_.push_back(true);
+  return *this;
+}
+
+JsonWriter& JsonWriter::EndArray() {
+  MALIPUT_THROW_UNLESS(!first_element_.empty());
+  first_element_.pop_back();
+  (*out_) << ']';
+  return *this;
+}
+
+JsonWriter& JsonWriter::Key(const std::string& key) {
+  BeginElement();
+  WriteString(key, out_);
+  (*out_) << ':';
+  after_key_ = true;
+  return *this;
+}
+
+JsonWriter& JsonWriter::Value(const std::string& value) {
+  BeginElement();
+  WriteString(value, out_);
+  return *this;
+}
+
+JsonWriter& JsonWriter::Value(const char* value) { return Value(std::string{value}); }
+
+JsonWriter& JsonWriter::Value(double value) {
+  if (!std::isfinite(value)) {
+    return Null();
+  }
+  BeginElement();
+  // A local stream is used so that the formatting state of `out_` is left untouched.
+  std::ostringstream ss;
+  ss.precision(std::numeric_limits<double>::max_digits10);
+  ss << value;
+  (*out_) << ss.str();
+  return *this;
+}
+
+JsonWriter& JsonWriter::Value(int value) { return Value(static_cast<std::int64_t>(value)); }
+
+JsonWriter& JsonWriter::Value(std::int64_t value) {
+  BeginElement();
+  (*out_) << value;
+  return *this;
+}
+
+JsonWriter& JsonWriter::Value(std::uint64_t value) {
+  BeginElement();
+  (*out_) << value;
+  return *this;
+}
+
+JsonWriter& JsonWriter::Value(bool value) {
+  BeginElement();
+  (*out_) << (value ? "true" : "false");
+  return *this;
+}
+
+JsonWriter& JsonWriter::Null() {
+  BeginElement();
+  (*out_) << "null";
+  return *this;
+}
+
+}  // namespace integration
+}  // namespace maliput
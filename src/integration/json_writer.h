@@ -0,0 +1,105 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Minimal streaming JSON writer.
+///
+/// Values are written to the output stream as soon as they are provided, so arbitrarily large documents can be
+/// emitted without holding them in memory. Commas and string escaping are handled by the writer; it is up to the
+/// caller to balance objects and arrays and to provide a key before every value within an object.
+///
+/// @code{cpp}
+/// JsonWriter writer(&std::cout);
+/// writer.StartObject().Key("lane").Value("1_0_1").Key("s").Value(3.5).EndObject();
+/// // Outputs: {"lane":"1_0_1","s":3.5}
+/// @endcode
+///
+/// Non-finite numbers are not representable in JSON and are written as `null`.
+class JsonWriter {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(JsonWriter)
+  JsonWriter() = delete;
+
+  /// Constructs a JsonWriter.
+  /// @param out Stream to write to. It must not be nullptr.
+  ///
+  /// @throw maliput::common::assertion_error When `out` is nullptr.
+  explicit JsonWriter(std::ostream* out);
+
+  /// Opens an object.
+  JsonWriter& StartObject();
+  /// Closes the last opened object.
+  JsonWriter& EndObject();
+  /// Opens an array.
+  JsonWriter& StartArray();
+  /// Closes the last opened array.
+  JsonWriter& EndArray();
+  /// Writes the `key` of the next member of the current object.
+  JsonWriter& Key(const std::string& key);
+  /// Writes a string value.
+  JsonWriter& Value(const std::string& value);
+  /// Writes a string value.
+  JsonWriter& Value(const char* value);
+  /// Writes a number value.
+  JsonWriter& Value(double value);
+  /// Writes a number value.
+  JsonWriter& Value(int value);
+  /// Writes a number value.
+  JsonWriter& Value(std::int64_t value);
+  /// Writes a number value.
+  JsonWriter& Value(std::uint64_t value);
+  /// Writes a boolean value.
+  JsonWriter& Value(bool value);
+  /// Writes a `null` value.
+  JsonWriter& Null();
+
+ private:
+  // Writes the separator that precedes a new element of the current container, if any.
+  void BeginElement();
+
+  std::ostream* out_{};
+  // Whether the next element is the first one of the container, one entry per open container.
+  std::vector<bool> first_element_;
+  // Whether the last written token was a key, in which case the next value must not be preceded by a comma.
+  bool after_key_{false};
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,263 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_graph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <utility>
+
+#include <maliput/api/branch_point.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+LaneGraph::LaneGraph(const api::RoadGeometry* road_geometry) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  // Lanes are walked in junction, segment and lane order so the indices don't depend on hashing.
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const api::Lane* lane = segment->lane(k);
+        lane_indices_.emplace(lane, static_cast<int>(lanes_.size()));
+        lanes_.push_back(lane);
+      }
+    }
+  }
+  edge_offsets_.reserve(lanes_.size() + 1);
+  edge_offsets_.push_back(0);
+  end_positions_.reserve(2 * lanes_.size());
+  for (const api::Lane* lane : lanes_) {
+    end_positions_.push_back(lane->ToInertialPosition(api::LanePosition(0., 0., 0.)));
+    end_positions_.push_back(lane->ToInertialPosition(api::LanePosition(lane->length(), 0., 0.)));
+    for (const api::LaneEnd::Which end : {api::LaneEnd::kStart, api::LaneEnd::kFinish}) {
+      const api::LaneEndSet* ongoing_branches = lane->GetOngoingBranches(end);
+      const double s = end == api::LaneEnd::kStart ? 0. : lane->length();
+      for (int i = 0; ongoing_branches != nullptr && i < ongoing_branches->size(); ++i) {
+        const api::Lane* next_lane = ongoing_branches->get(i).lane;
+        edge_targets_.push_back(GetLaneIndex(next_lane));
+        edge_weights_.push_back(next_lane->length());
+        edge_s_.push_back(s);
+      }
+    }
+    edge_offsets_.push_back(static_cast<int>(edge_targets_.size()));
+  }
+}
+
+int LaneGraph::GetLaneIndex(const api::Lane* lane) const {
+  const auto it = lane_indices_.find(lane);
+  MALIPUT_THROW_UNLESS(it != lane_indices_.end());
+  return it->second;
+}
+
+void LaneGraph::FindSequences(int target, double length, double max_length, std::vector<char>* visited,
+                              std::vector<int>* path, std::vector<std::vector<int>>* sequences) const {
+  const int lane_index = path->back();
+  for (int edge = edge_offsets_[lane_index]; edge < edge_offsets_[lane_index + 1]; ++edge) {
+    const int next_index = edge_targets_[edge];
+    if (next_index == target) {
+      sequences->push_back(*path);
+      sequences->back().push_back(target);
+      continue;
+    }
+    // The target lane doesn't count towards the length, only the intermediate ones do.
+    const double next_length = length + edge_weights_[edge];
+    if (next_length > max_length || (*visited)[next_index]) {
+      continue;
+    }
+    (*visited)[next_index] = true;
+    path->push_back(next_index);
+    FindSequences(target, next_length, max_length, visited, path, sequences);
+    path->pop_back();
+    (*visited)[next_index] = false;
+  }
+}
+
+std::vector<std::vector<int>> LaneGraph::FindIndexSequences(int start, int end, double max_length) const {
+  if (start == end) {
+    return {{start}};
+  }
+  std::vector<std::vector<int>> sequences;
+  std::vector<char> visited(lanes_.size(), false);
+  visited[start] = true;
+  std::vector<int> path{start};
+  FindSequences(end, 0., max_length, &visited, &path, &sequences);
+  return sequences;
+}
+
+std::vector<std::vector<const api::Lane*>> LaneGraph::FindLaneSequences(const api::Lane* start,
+                                                                        const api::Lane* end,
+                                                                        double max_length) const {
+  std::vector<std::vector<const api::Lane*>> lane_sequences;
+  for (const std::vector<int>& sequence : FindIndexSequences(GetLaneIndex(start), GetLaneIndex(end), max_length)) {
+    std::vector<const api::Lane*> lane_sequence;
+    lane_sequence.reserve(sequence.size());
+    for (const int lane_index : sequence) {
+      lane_sequence.push_back(lanes_[lane_index]);
+    }
+    lane_sequences.push_back(std::move(lane_sequence));
+  }
+  return lane_sequences;
+}
+
+double LaneGraph::GetEdgeS(int lane_index, int other_index) const {
+  for (int edge = edge_offsets_[lane_index]; edge < edge_offsets_[lane_index + 1]; ++edge) {
+    if (edge_targets_[edge] == other_index) {
+      return edge_s_[edge];
+    }
+  }
+  MALIPUT_THROW_MESSAGE("Lane " + lanes_[lane_index]->id().string() + " doesn't branch into lane " +
+                        lanes_[other_index]->id().string() + ".");
+}
+
+api::LaneSRoute LaneGraph::ToLaneSRoute(const std::vector<int>& sequence, const api::RoadPosition& start,
+                                        const api::RoadPosition& end) const {
+  std::vector<api::LaneSRange> ranges;
+  ranges.reserve(sequence.size());
+  if (sequence.size() == 1) {
+    ranges.emplace_back(start.lane->id(), api::SRange(start.pos.s(), end.pos.s()));
+    return api::LaneSRoute(ranges);
+  }
+  // Intermediate lanes are traversed from the end they share with the previous lane to the end they share with the
+  // next one.
+  for (std::size_t i = 0; i < sequence.size(); ++i) {
+    const double s0 = i == 0 ? start.pos.s() : GetEdgeS(sequence[i], sequence[i - 1]);
+    const double s1 = i + 1 == sequence.size() ? end.pos.s() : GetEdgeS(sequence[i], sequence[i + 1]);
+    ranges.emplace_back(lanes_[sequence[i]]->id(), api::SRange(s0, s1));
+  }
+  return api::LaneSRoute(ranges);
+}
+
+std::vector<api::LaneSRoute> LaneGraph::DeriveLaneSRoutes(const api::RoadPosition& start, const api::RoadPosition& end,
+                                                          double max_length) const {
+  const std::vector<std::vector<int>> sequences =
+      FindIndexSequences(GetLaneIndex(start.lane), GetLaneIndex(end.lane), max_length);
+  std::vector<api::LaneSRoute> routes;
+  routes.reserve(sequences.size());
+  for (const std::vector<int>& sequence : sequences) {
+    routes.push_back(ToLaneSRoute(sequence, start, end));
+  }
+  return routes;
+}
+
+std::vector<api::LaneSRoute> LaneGraph::DeriveShortestLaneSRoutes(const api::RoadPosition& start,
+                                                                  const api::RoadPosition& end, double max_length,
+                                                                  int max_num_routes) const {
+  MALIPUT_THROW_UNLESS(max_num_routes > 0);
+  const int start_index = GetLaneIndex(start.lane);
+  const int end_index = GetLaneIndex(end.lane);
+  if (start_index == end_index) {
+    return {ToLaneSRoute({start_index}, start, end)};
+  }
+  // Route lengths are measured along s, so the goal is the centerline point of `end`. Its r and h offsets would make
+  // the heuristic overestimate the remaining length.
+  const api::InertialPosition goal = end.lane->ToInertialPosition(api::LanePosition(end.pos.s(), 0., 0.));
+
+  // Partial routes form a tree rooted at `start`: each node is a lane, entered at `entry_s`, and its parent is the
+  // previous lane. Nodes on the lane of `end` are complete routes.
+  struct Node {
+    int lane_index{};
+    int parent{};
+    double entry_s{};
+    // Length of the route up to `entry_s`, or up to `end` for complete routes.
+    double length{};
+    // Accumulated length of the intermediate lanes, as bounded by `max_length`.
+    double intermediate_length{};
+  };
+  // Nodes to expand, ordered by their estimated route length and then by their creation order.
+  struct Candidate {
+    double estimated_length{};
+    int node{};
+    bool operator>(const Candidate& other) const {
+      return estimated_length != other.estimated_length ? estimated_length > other.estimated_length
+                                                        : node > other.node;
+    }
+  };
+  std::vector<Node> nodes{{start_index, -1, start.pos.s(), 0., 0.}};
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+  candidates.push({0., 0});
+  const auto is_in_route = [&nodes](int node, int lane_index) {
+    for (; node != -1; node = nodes[node].parent) {
+      if (nodes[node].lane_index == lane_index) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  std::vector<api::LaneSRoute> routes;
+  while (!candidates.empty() && static_cast<int>(routes.size()) < max_num_routes) {
+    const int node_index = candidates.top().node;
+    candidates.pop();
+    const Node node = nodes[node_index];
+    if (node.lane_index == end_index) {
+      std::vector<int> sequence;
+      for (int i = node_index; i != -1; i = nodes[i].parent) {
+        sequence.push_back(nodes[i].lane_index);
+      }
+      std::reverse(sequence.begin(), sequence.end());
+      routes.push_back(ToLaneSRoute(sequence, start, end));
+      continue;
+    }
+    // Same exploration and pruning as FindSequences().
+    for (int edge = edge_offsets_[node.lane_index]; edge < edge_offsets_[node.lane_index + 1]; ++edge) {
+      const int next_index = edge_targets_[edge];
+      const double next_intermediate_length = node.intermediate_length + edge_weights_[edge];
+      if (next_index != end_index &&
+          (next_intermediate_length > max_length || is_in_route(node_index, next_index))) {
+        continue;
+      }
+      const double exit_s = GetEdgeS(node.lane_index, next_index);
+      const double entry_s = GetEdgeS(next_index, node.lane_index);
+      const double length = node.length + std::abs(exit_s - node.entry_s);
+      if (next_index == end_index) {
+        const double route_length = length + std::abs(end.pos.s() - entry_s);
+        nodes.push_back({next_index, node_index, entry_s, route_length, node.intermediate_length});
+        candidates.push({route_length, static_cast<int>(nodes.size()) - 1});
+        continue;
+      }
+      // The rest of the route, from where it enters the next lane, can't be shorter than the straight line to `end`.
+      const api::InertialPosition& entry_position = end_positions_[2 * next_index + (entry_s == 0. ? 0 : 1)];
+      nodes.push_back({next_index, node_index, entry_s, length, next_intermediate_length});
+      candidates.push({length + entry_position.Distance(goal), static_cast<int>(nodes.size()) - 1});
+    }
+  }
+  return routes;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,148 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Lane connectivity of an api::RoadGeometry, flattened into a compressed sparse row (CSR) graph to derive routes
+/// without walking the api::BranchPoints on every query.
+///
+/// Lanes are the nodes, indexed in junction, segment and lane order. The ongoing branches of each lane are its edges:
+/// first those at its api::LaneEnd::kStart and then those at its api::LaneEnd::kFinish, each in api::LaneEndSet order,
+/// which is the order maliput::routing::DeriveLaneSRoutes() explores them in. Edges are weighted by the length of the
+/// lane they lead to. The inertial positions of the lane ends are kept too, to guide shortest route searches. The graph
+/// is built once, after loading, and is immutable afterwards, so it can be queried from many threads at once.
+class LaneGraph {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LaneGraph)
+  LaneGraph() = delete;
+
+  /// Constructs a LaneGraph.
+  /// @param road_geometry The road geometry whose lanes are connected. It must not be nullptr and must outlive the
+  ///        LaneGraph.
+  /// @throw maliput::common::assertion_error When `road_geometry` is nullptr or a branch leads to a lane that is not
+  ///        in it.
+  explicit LaneGraph(const api::RoadGeometry* road_geometry);
+
+  /// Finds the sequences of lanes that connect `start` to `end`, as maliput::routing::FindLaneSequences() does.
+  ///
+  /// Lanes are not visited twice in a sequence, and the accumulated length of the intermediate lanes of a sequence
+  /// must not exceed `max_length`.
+  /// @param start The lane to start from. It must be in the graph.
+  /// @param end The lane to end at. It must be in the graph.
+  /// @param max_length The maximum length of the intermediate lanes.
+  /// @returns The sequences of lanes, from `start` to `end`. It is `{{start}}` when both are the same lane.
+  /// @throw maliput::common::assertion_error When `start` or `end` are not in the graph.
+  std::vector<std::vector<const api::Lane*>> FindLaneSequences(const api::Lane* start, const api::Lane* end,
+                                                               double max_length) const;
+
+  /// Derives the routes from `start` to `end`, as maliput::routing::DeriveLaneSRoutes() does.
+  /// @param start The position to start from. Its lane must be in the graph.
+  /// @param end The position to end at. Its lane must be in the graph.
+  /// @param max_length The maximum length of the intermediate lanes. See FindLaneSequences().
+  /// @returns The routes, one per sequence of lanes returned by FindLaneSequences(), in the same order.
+  /// @throw maliput::common::assertion_error When the lanes of `start` or `end` are not in the graph.
+  std::vector<api::LaneSRoute> DeriveLaneSRoutes(const api::RoadPosition& start, const api::RoadPosition& end,
+                                                 double max_length) const;
+
+  /// Derives the `max_num_routes` shortest routes from `start` to `end`, out of those DeriveLaneSRoutes() returns.
+  ///
+  /// The length of a route is the sum of the lengths of its api::LaneSRanges. Routes are searched best-first, with the
+  /// Euclidean distance from the lane ends to `end` as an A* heuristic, so the search stops as soon as the requested
+  /// routes are found instead of enumerating all of them. Partial routes whose intermediate lanes exceed `max_length`
+  /// are pruned as they are generated.
+  /// @param start The position to start from. Its lane must be in the graph.
+  /// @param end The position to end at. Its lane must be in the graph.
+  /// @param max_length The maximum length of the intermediate lanes. See FindLaneSequences().
+  /// @param max_num_routes The maximum number of routes to derive. It must be positive.
+  /// @returns The shortest routes, in ascending length order. Routes of the same length are in discovery order.
+  /// @throw maliput::common::assertion_error When the lanes of `start` or `end` are not in the graph or
+  ///        `max_num_routes` is not positive.
+  std::vector<api::LaneSRoute> DeriveShortestLaneSRoutes(const api::RoadPosition& start, const api::RoadPosition& end,
+                                                         double max_length, int max_num_routes) const;
+
+  /// @returns The index of `lane` in the graph.
+  /// @throw maliput::common::assertion_error When `lane` is not in the graph.
+  int GetLaneIndex(const api::Lane* lane) const;
+
+  /// @returns The lane at `index`. It must be in [0, num_lanes()).
+  const api::Lane* lane(int index) const { return lanes_.at(index); }
+
+  /// @returns The number of lanes.
+  int num_lanes() const { return static_cast<int>(lanes_.size()); }
+
+  /// @returns The number of edges, i.e. of ongoing branches of all the lanes.
+  int num_edges() const { return static_cast<int>(edge_targets_.size()); }
+
+ private:
+  // Appends to @p sequences every sequence that continues @p path, whose last lane is reached after @p length of
+  // intermediate lanes, and reaches @p target. @p visited flags the lanes in @p path.
+  void FindSequences(int target, double length, double max_length, std::vector<char>* visited,
+                     std::vector<int>* path, std::vector<std::vector<int>>* sequences) const;
+
+  // @returns The sequences of lane indices that connect @p start to @p end. See FindLaneSequences().
+  std::vector<std::vector<int>> FindIndexSequences(int start, int end, double max_length) const;
+
+  // @returns The s coordinate of the end of the lane at @p lane_index that first branches into the lane at
+  // @p other_index.
+  // @throws maliput::common::assertion_error When the lanes are not connected.
+  double GetEdgeS(int lane_index, int other_index) const;
+
+  // @returns The route along the lane indices of @p sequence, from @p start to @p end.
+  api::LaneSRoute ToLaneSRoute(const std::vector<int>& sequence, const api::RoadPosition& start,
+                               const api::RoadPosition& end) const;
+
+  std::vector<const api::Lane*> lanes_;
+  std::unordered_map<const api::Lane*, int> lane_indices_;
+  // The edges of the lane at index i are in [edge_offsets_[i], edge_offsets_[i + 1]).
+  std::vector<int> edge_offsets_;
+  // Index of the lane each edge leads to.
+  std::vector<int> edge_targets_;
+  // Length of the lane each edge leads to.
+  std::vector<double> edge_weights_;
+  // s coordinate, on the lane each edge leaves, of the end it leaves from.
+  std::vector<double> edge_s_;
+  // Inertial positions of the api::LaneEnd::kStart and api::LaneEnd::kFinish ends of the lane at index i, at indices
+  // 2 * i and 2 * i + 1.
+  std::vector<api::InertialPosition> end_positions_;
+};
+
+}  // namespace integration
+}  // namespace maliput
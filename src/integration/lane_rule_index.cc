@@ -0,0 +1,151 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_rule_index.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns All the rules of @p rulebook.
+// @throws maliput::common::assertion_error When @p rulebook is nullptr.
+api::rules::RoadRulebook::QueryResults GetRules(const api::rules::RoadRulebook* rulebook) {
+  MALIPUT_THROW_UNLESS(rulebook != nullptr);
+  return rulebook->Rules();
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+// Adds a copy of @p rule to @p results.
+void Insert(const api::rules::RightOfWayRule* rule, api::rules::RoadRulebook::QueryResults* results) {
+  results->right_of_way.emplace(rule->id(), *rule);
+}
+
+void Insert(const api::rules::SpeedLimitRule* rule, api::rules::RoadRulebook::QueryResults* results) {
+  results->speed_limit.emplace(rule->id(), *rule);
+}
+
+void Insert(const api::rules::DirectionUsageRule* rule, api::rules::RoadRulebook::QueryResults* results) {
+  results->direction_usage.emplace(rule->id(), *rule);
+}
+#pragma GCC diagnostic pop
+
+void Insert(const api::rules::DiscreteValueRule* rule, api::rules::RoadRulebook::QueryResults* results) {
+  results->discrete_value_rules.emplace(rule->id(), *rule);
+}
+
+void Insert(const api::rules::RangeValueRule* rule, api::rules::RoadRulebook::QueryResults* results) {
+  results->range_value_rules.emplace(rule->id(), *rule);
+}
+
+}  // namespace
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+LaneRuleIndex::LaneRuleIndex(const api::rules::RoadRulebook* rulebook) : rules_(GetRules(rulebook)) {
+  for (const auto& id_rule : rules_.right_of_way) {
+    AddEntries(id_rule.second.zone().ranges(), &id_rule.second);
+  }
+  for (const auto& id_rule : rules_.speed_limit) {
+    AddEntries({id_rule.second.zone()}, &id_rule.second);
+  }
+  for (const auto& id_rule : rules_.direction_usage) {
+    AddEntries({id_rule.second.zone()}, &id_rule.second);
+  }
+  for (const auto& id_rule : rules_.discrete_value_rules) {
+    AddEntries(id_rule.second.zone().ranges(), &id_rule.second);
+  }
+  for (const auto& id_rule : rules_.range_value_rules) {
+    AddEntries(id_rule.second.zone().ranges(), &id_rule.second);
+  }
+  for (auto& lane_entries : entries_) {
+    std::sort(lane_entries.second.begin(), lane_entries.second.end(),
+              [](const Entry& lhs, const Entry& rhs) { return lhs.s_min < rhs.s_min; });
+    double running_s_max = -std::numeric_limits<double>::infinity();
+    for (Entry& entry : lane_entries.second) {
+      running_s_max = std::max(running_s_max, entry.s_max);
+      entry.running_s_max = running_s_max;
+    }
+  }
+}
+#pragma GCC diagnostic pop
+
+void LaneRuleIndex::AddEntries(const std::vector<api::LaneSRange>& ranges, RulePtr rule) {
+  for (const api::LaneSRange& range : ranges) {
+    const api::SRange& s_range = range.s_range();
+    entries_[range.lane_id()].push_back(
+        {std::min(s_range.s0(), s_range.s1()), std::max(s_range.s0(), s_range.s1()), 0., rule});
+  }
+}
+
+api::rules::RoadRulebook::QueryResults LaneRuleIndex::FindRules(const api::LaneSRange& lane_s_range,
+                                                                double tolerance) const {
+  MALIPUT_THROW_UNLESS(tolerance >= 0.);
+  api::rules::RoadRulebook::QueryResults results;
+  const auto it = entries_.find(lane_s_range.lane_id());
+  if (it == entries_.end()) {
+    return results;
+  }
+  const std::vector<Entry>& entries = it->second;
+  const api::SRange& s_range = lane_s_range.s_range();
+  const double s_min = std::min(s_range.s0(), s_range.s1()) - tolerance;
+  const double s_max = std::max(s_range.s0(), s_range.s1()) + tolerance;
+  // Entries before the first one whose running maximum reaches `s_min` all end before the range.
+  const auto begin = std::lower_bound(entries.begin(), entries.end(), s_min,
+                                      [](const Entry& entry, double s) { return entry.running_s_max < s; });
+  // Entries starting beyond `s_max` cannot overlap the range.
+  const auto end = std::upper_bound(entries.begin(), entries.end(), s_max,
+                                    [](double s, const Entry& entry) { return s < entry.s_min; });
+  for (auto entry = begin; entry < end; ++entry) {
+    if (entry->s_max >= s_min) {
+      std::visit([&results](auto rule) { Insert(rule, &results); }, entry->rule);
+    }
+  }
+  return results;
+}
+
+api::rules::RoadRulebook::QueryResults LaneRuleIndex::FindRules(const api::LaneId& lane_id) const {
+  api::rules::RoadRulebook::QueryResults results;
+  const auto it = entries_.find(lane_id);
+  if (it == entries_.end()) {
+    return results;
+  }
+  for (const Entry& entry : it->second) {
+    std::visit([&results](auto rule) { Insert(rule, &results); }, entry.rule);
+  }
+  return results;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,106 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/rules/road_rulebook.h>
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Indexes the rules of an api::rules::RoadRulebook by lane, to answer repeated api::rules::RoadRulebook::FindRules()
+/// queries without walking the whole rulebook.
+///
+/// The rules are copied once, at construction, and their zones are split into per-lane entries sorted by their start
+/// s coordinate. Each entry also keeps the largest end s coordinate seen up to it, so a query bisects both ends of the
+/// entries of a single lane and only walks the ones in between. Rules are static, whereas their states are not:
+/// states must still be queried from the state providers.
+class LaneRuleIndex {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LaneRuleIndex)
+
+  LaneRuleIndex() = delete;
+
+  /// Constructs a LaneRuleIndex.
+  /// @param rulebook The rulebook to index. It must not be nullptr. It is only used during construction.
+  /// @throw maliput::common::assertion_error When `rulebook` is nullptr.
+  explicit LaneRuleIndex(const api::rules::RoadRulebook* rulebook);
+
+  /// Finds the rules whose zones overlap `lane_s_range`, as api::rules::RoadRulebook::FindRules() would do for
+  /// `{lane_s_range}`.
+  /// @param lane_s_range The range to look for rules at.
+  /// @param tolerance Tolerance to consider ranges overlapping. It must not be negative.
+  /// @returns The rules that apply to `lane_s_range`.
+  /// @throw maliput::common::assertion_error When `tolerance` is negative.
+  api::rules::RoadRulebook::QueryResults FindRules(const api::LaneSRange& lane_s_range, double tolerance) const;
+
+  /// Finds all the rules whose zones overlap the lane identified by `lane_id`.
+  /// @param lane_id The lane to look for rules at.
+  /// @returns The rules that apply to the lane. It is empty when the lane has no rules.
+  api::rules::RoadRulebook::QueryResults FindRules(const api::LaneId& lane_id) const;
+
+  /// @returns The number of lanes that have at least one rule.
+  int num_lanes() const { return static_cast<int>(entries_.size()); }
+
+ private:
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  // A rule of any of the types api::rules::RoadRulebook::QueryResults holds. It points into `rules_`.
+  using RulePtr = std::variant<const api::rules::RightOfWayRule*, const api::rules::SpeedLimitRule*,
+                               const api::rules::DirectionUsageRule*, const api::rules::DiscreteValueRule*,
+                               const api::rules::RangeValueRule*>;
+#pragma GCC diagnostic pop
+
+  // The part of a rule's zone that lies on a lane.
+  struct Entry {
+    double s_min{};
+    double s_max{};
+    // Largest `s_max` of this and all the preceding entries of the lane.
+    double running_s_max{};
+    RulePtr rule;
+  };
+
+  // Adds an Entry of @p rule per api::LaneSRange in @p ranges.
+  void AddEntries(const std::vector<api::LaneSRange>& ranges, RulePtr rule);
+
+  // Copy of the rulebook's rules, owning the rules `entries_` point to.
+  const api::rules::RoadRulebook::QueryResults rules_;
+  // Entries by lane, sorted by `s_min`, so their `running_s_max` is non-decreasing.
+  std::unordered_map<api::LaneId, std::vector<Entry>> entries_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,296 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_spatial_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+
+#include "integration/lane_volume.h"
+#include "integration/overlapping_lanes.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Maximum number of lanes held by a leaf.
+constexpr int kMaxLeafSize{4};
+
+// @returns The box bounding @p lane, sampled every @p sampling_step at most.
+AxisAlignedBox ComputeLaneBox(const api::Lane* lane, double sampling_step, double padding_tolerance) {
+  const double length = lane->length();
+  const int num_intervals = std::max(1, static_cast<int>(std::ceil(length / sampling_step)));
+  AxisAlignedBox box;
+  double padding{0.};
+  LaneCrossSection previous_cross_section;
+  for (int i = 0; i <= num_intervals; ++i) {
+    const double s = length * i / num_intervals;
+    // Segment bounds contain the lane bounds, so the box also covers positions ToSegmentPosition() could return.
+    const LaneCrossSection cross_section = SampleLaneCrossSection(lane, s, lane->segment_bounds(s));
+    for (const math::Vector3& corner : cross_section.corners) {
+      box.Extend(corner);
+    }
+    if (i > 0) {
+      padding = std::max(padding, ComputeLaneVolumeDeviation(previous_cross_section, cross_section));
+    }
+    previous_cross_section = cross_section;
+  }
+  // The box holds the convex hull of the sampled corners, so it only needs to be grown by how far the lane strays from
+  // it between samples.
+  padding += padding_tolerance;
+  box.min = box.min - math::Vector3(padding, padding, padding);
+  box.max = box.max + math::Vector3(padding, padding, padding);
+  return box;
+}
+
+}  // namespace
+
+void AxisAlignedBox::Extend(const math::Vector3& point) {
+  if (empty) {
+    min = point;
+    max = point;
+    empty = false;
+    return;
+  }
+  for (int i = 0; i < 3; ++i) {
+    min[i] = std::min(min[i], point[i]);
+    max[i] = std::max(max[i], point[i]);
+  }
+}
+
+void AxisAlignedBox::Extend(const AxisAlignedBox& other) {
+  if (other.empty) {
+    return;
+  }
+  Extend(other.min);
+  Extend(other.max);
+}
+
+double AxisAlignedBox::SquaredDistance(const math::Vector3& point) const {
+  double squared_distance{0.};
+  for (int i = 0; i < 3; ++i) {
+    const double delta = std::max({min[i] - point[i], 0., point[i] - max[i]});
+    squared_distance += delta * delta;
+  }
+  return squared_distance;
+}
+
+bool AxisAlignedBox::Intersects(const AxisAlignedBox& other) const {
+  for (int i = 0; i < 3; ++i) {
+    if (other.max[i] < min[i] || max[i] < other.min[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+math::Vector3 AxisAlignedBox::center() const { return 0.5 * (min + max); }
+
+LaneSpatialIndex::LaneSpatialIndex(const api::RoadGeometry* road_geometry, double sampling_step)
+    : road_geometry_(road_geometry) {
+  MALIPUT_THROW_UNLESS(road_geometry_ != nullptr);
+  MALIPUT_THROW_UNLESS(sampling_step > 0.);
+  // Lanes are walked in junction, segment and lane order so the hierarchy doesn't depend on hashing.
+  std::vector<std::pair<AxisAlignedBox, const api::Lane*>> items;
+  for (int i = 0; i < road_geometry_->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry_->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const api::Lane* lane = segment->lane(k);
+        items.emplace_back(ComputeLaneBox(lane, sampling_step, road_geometry_->linear_tolerance()), lane);
+      }
+    }
+  }
+  if (items.empty()) {
+    return;
+  }
+  for (auto& item : items) {
+    lane_orders_.emplace(item.second, static_cast<int>(road_lanes_.size()));
+    road_lanes_.push_back(item.second);
+    lane_boxes_.push_back(item.first);
+    lanes_.push_back(item.second);
+  }
+  nodes_.reserve(2 * lanes_.size());
+  nodes_.emplace_back();
+  Build(0, 0, static_cast<int>(lanes_.size()));
+  for (int i = 0; i < static_cast<int>(lanes_.size()); ++i) {
+    lane_indices_.emplace(lanes_[i], i);
+  }
+}
+
+void LaneSpatialIndex::Build(int node_index, int begin, int end) {
+  AxisAlignedBox box;
+  AxisAlignedBox centers;
+  for (int i = begin; i < end; ++i) {
+    box.Extend(lane_boxes_[i]);
+    centers.Extend(lane_boxes_[i].center());
+  }
+  nodes_[node_index].box = box;
+  if (end - begin <= kMaxLeafSize) {
+    nodes_[node_index].first = begin;
+    nodes_[node_index].count = end - begin;
+    return;
+  }
+  // Splits at the median center along the axis the centers spread the most.
+  const math::Vector3 extent = centers.max - centers.min;
+  const int axis = extent[0] >= extent[1] ? (extent[0] >= extent[2] ? 0 : 2) : (extent[1] >= extent[2] ? 1 : 2);
+  std::vector<int> order(end - begin);
+  for (int i = begin; i < end; ++i) {
+    order[i - begin] = i;
+  }
+  const int middle = (end - begin) / 2;
+  std::nth_element(order.begin(), order.begin() + middle, order.end(), [this, axis](int lhs, int rhs) {
+    return lane_boxes_[lhs].center()[axis] < lane_boxes_[rhs].center()[axis];
+  });
+  std::vector<const api::Lane*> lanes(end - begin);
+  std::vector<AxisAlignedBox> lane_boxes(end - begin);
+  for (int i = 0; i < end - begin; ++i) {
+    lanes[i] = lanes_[order[i]];
+    lane_boxes[i] = lane_boxes_[order[i]];
+  }
+  std::copy(lanes.begin(), lanes.end(), lanes_.begin() + begin);
+  std::copy(lane_boxes.begin(), lane_boxes.end(), lane_boxes_.begin() + begin);
+
+  const int left_index = static_cast<int>(nodes_.size());
+  nodes_.emplace_back();
+  nodes_.emplace_back();
+  nodes_[node_index].first = left_index;
+  nodes_[node_index].count = 0;
+  Build(left_index, begin, begin + middle);
+  Build(left_index + 1, begin + middle, end);
+}
+
+template <typename AcceptBox, typename OnLane>
+void LaneSpatialIndex::Traverse(AcceptBox accept_box, OnLane on_lane) const {
+  if (nodes_.empty()) {
+    return;
+  }
+  std::vector<int> pending{0};
+  while (!pending.empty()) {
+    const Node& node = nodes_[pending.back()];
+    pending.pop_back();
+    if (!accept_box(node.box)) {
+      continue;
+    }
+    if (node.count == 0) {
+      pending.push_back(node.first);
+      pending.push_back(node.first + 1);
+      continue;
+    }
+    for (int i = node.first; i < node.first + node.count; ++i) {
+      if (accept_box(lane_boxes_[i])) {
+        on_lane(lanes_[i]);
+      }
+    }
+  }
+}
+
+std::vector<const api::Lane*> LaneSpatialIndex::FindLanesNear(const math::Vector3& point, double radius) const {
+  const double squared_radius = radius * radius;
+  std::vector<const api::Lane*> lanes;
+  Traverse([&point, squared_radius](const AxisAlignedBox& box) { return box.SquaredDistance(point) <= squared_radius; },
+           [&lanes](const api::Lane* lane) { lanes.push_back(lane); });
+  return lanes;
+}
+
+std::vector<const api::Lane*> LaneSpatialIndex::FindLanesIntersecting(const AxisAlignedBox& box) const {
+  std::vector<const api::Lane*> lanes;
+  Traverse([&box](const AxisAlignedBox& node_box) { return node_box.Intersects(box); },
+           [&lanes](const api::Lane* lane) { lanes.push_back(lane); });
+  return lanes;
+}
+
+std::vector<api::RoadPositionResult> LaneSpatialIndex::FindRoadPositions(const api::InertialPosition& inertial_position,
+                                                                         double radius) const {
+  MALIPUT_THROW_UNLESS(radius >= 0.);
+  std::vector<api::RoadPositionResult> results;
+  for (const api::Lane* lane : FindLanesNear(inertial_position.xyz(), radius)) {
+    const api::LanePositionResult result = lane->ToLanePosition(inertial_position);
+    if (result.distance <= radius) {
+      results.push_back({api::RoadPosition(lane, result.lane_position), result.nearest_position, result.distance});
+    }
+  }
+  return results;
+}
+
+std::vector<const api::Lane*> LaneSpatialIndex::FindOverlappingLanesIn(
+    const math::BoundingRegion<math::Vector3>& region, math::OverlappingType overlapping_type, double sampling_step,
+    ThreadPool* thread_pool) const {
+  MALIPUT_THROW_UNLESS(sampling_step > 0.);
+  const math::BoundingBox* bounding_box = dynamic_cast<const math::BoundingBox*>(&region);
+  if (bounding_box == nullptr) {
+    return integration::FindOverlappingLanesIn(lanes_, region, overlapping_type, sampling_step, thread_pool);
+  }
+  AxisAlignedBox box;
+  for (const math::Vector3& vertex : bounding_box->get_vertices()) {
+    box.Extend(vertex);
+  }
+  // Candidates are classified in junction, segment and lane order, so lanes are listed as the unpruned overload does.
+  std::vector<const api::Lane*> candidates = FindLanesIntersecting(box);
+  std::sort(candidates.begin(), candidates.end(), [this](const api::Lane* lhs, const api::Lane* rhs) {
+    return lane_orders_.at(lhs) < lane_orders_.at(rhs);
+  });
+  const std::vector<const api::Lane*> overlapping_lanes =
+      integration::FindOverlappingLanesIn(candidates, region, overlapping_type, sampling_step, thread_pool);
+  if (overlapping_type != math::OverlappingType::kDisjointed) {
+    return overlapping_lanes;
+  }
+  // The lanes that are not candidates are disjointed too. They are merged in order with the disjointed candidates,
+  // which are a subsequence of the candidates, which are a subsequence of road_lanes_.
+  std::vector<const api::Lane*> disjointed_lanes;
+  std::size_t candidate_index{0};
+  std::size_t overlapping_index{0};
+  for (const api::Lane* lane : road_lanes_) {
+    if (candidate_index < candidates.size() && candidates[candidate_index] == lane) {
+      ++candidate_index;
+      if (overlapping_index == overlapping_lanes.size() || overlapping_lanes[overlapping_index] != lane) {
+        continue;
+      }
+      ++overlapping_index;
+    }
+    disjointed_lanes.push_back(lane);
+  }
+  return disjointed_lanes;
+}
+
+const AxisAlignedBox& LaneSpatialIndex::GetLaneBox(const api::Lane* lane) const {
+  const auto it = lane_indices_.find(lane);
+  MALIPUT_THROW_UNLESS(it != lane_indices_.end());
+  return lane_boxes_[it->second];
+}
+
+}  // namespace integration
+}  // namespace maliput
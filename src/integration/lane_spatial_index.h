@@ -0,0 +1,153 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/maliput_copyable.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace integration {
+
+class ThreadPool;
+
+/// Axis-aligned box in the inertial frame.
+struct AxisAlignedBox {
+  /// Grows the box to contain `point`.
+  void Extend(const math::Vector3& point);
+
+  /// Grows the box to contain `other`.
+  void Extend(const AxisAlignedBox& other);
+
+  /// @returns The squared distance between `point` and the box, zero when `point` is inside of it.
+  double SquaredDistance(const math::Vector3& point) const;
+
+  /// @returns True when the box and `other` share any point.
+  bool Intersects(const AxisAlignedBox& other) const;
+
+  /// @returns The center of the box.
+  math::Vector3 center() const;
+
+  math::Vector3 min{};
+  math::Vector3 max{};
+  /// Whether the box holds no point yet.
+  bool empty{true};
+};
+
+/// Bounding volume hierarchy of the lanes of an api::RoadGeometry, used to prune the lanes considered by spatial
+/// queries before running their exact geometric tests.
+///
+/// Lanes are bounded by sampling their segment bounds and elevation bounds every `sampling_step` along them. Boxes are
+/// padded by ComputeLaneVolumeDeviation() between consecutive samples so that they contain the lane volume between
+/// them, including the outer edge of curves.
+class LaneSpatialIndex {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(LaneSpatialIndex)
+  LaneSpatialIndex() = delete;
+
+  /// Constructs a LaneSpatialIndex.
+  /// @param road_geometry The road geometry whose lanes are indexed. It must not be nullptr.
+  /// @param sampling_step Distance between the samples taken along the lanes. It must be positive.
+  /// @throw maliput::common::assertion_error When `road_geometry` is nullptr or `sampling_step` is not positive.
+  explicit LaneSpatialIndex(const api::RoadGeometry* road_geometry, double sampling_step = 1.);
+
+  /// @returns The lanes whose boxes are within `radius` of `point`. They are a superset of the lanes whose volume is
+  ///          within `radius` of `point`.
+  std::vector<const api::Lane*> FindLanesNear(const math::Vector3& point, double radius) const;
+
+  /// @returns The lanes whose boxes intersect `box`. They are a superset of the lanes whose volume intersects `box`.
+  std::vector<const api::Lane*> FindLanesIntersecting(const AxisAlignedBox& box) const;
+
+  /// Pruned equivalent of api::RoadGeometry::FindRoadPositions(): only the lanes returned by FindLanesNear() are
+  /// projected with api::Lane::ToLanePosition().
+  /// @param inertial_position The position to look around.
+  /// @param radius Maximum distance between `inertial_position` and the returned positions. It must be non negative.
+  /// @returns The positions on the lanes within `radius` of `inertial_position`, in no particular order.
+  /// @throw maliput::common::assertion_error When `radius` is negative.
+  std::vector<api::RoadPositionResult> FindRoadPositions(const api::InertialPosition& inertial_position,
+                                                         double radius) const;
+
+  /// Pruned equivalent of integration::FindOverlappingLanesIn(): only the lanes returned by FindLanesIntersecting() for
+  /// the box bounding `region` are classified with ComputeLaneOverlapping(), the rest are disjointed from it. Regions
+  /// other than math::BoundingBox are not pruned.
+  /// @param region The region to check the lanes against.
+  /// @param overlapping_type The classification of the lanes to find.
+  /// @param sampling_step Maximum length of the lane pieces. It must be positive.
+  /// @param thread_pool Optional pool to run the classifications on.
+  /// @returns The lanes classified as `overlapping_type`, in junction, segment and lane order, as the unpruned
+  ///          overload lists them.
+  /// @throw maliput::common::assertion_error When `sampling_step` is not positive.
+  std::vector<const api::Lane*> FindOverlappingLanesIn(const math::BoundingRegion<math::Vector3>& region,
+                                                       math::OverlappingType overlapping_type, double sampling_step,
+                                                       ThreadPool* thread_pool = nullptr) const;
+
+  /// @returns The box of `lane`. It must be an indexed lane.
+  /// @throw maliput::common::assertion_error When `lane` is not indexed.
+  const AxisAlignedBox& GetLaneBox(const api::Lane* lane) const;
+
+  /// @returns The number of indexed lanes.
+  int num_lanes() const { return static_cast<int>(lanes_.size()); }
+
+ private:
+  // Node of the hierarchy. Inner nodes have two children: `first` is the index of the left one in nodes_, and the right
+  // one follows it. Leaves hold `count` lanes starting at index `first` of lanes_.
+  struct Node {
+    AxisAlignedBox box;
+    int first{0};
+    int count{0};
+  };
+
+  // Builds the subtree of the lanes in [@p begin, @p end) into the node at @p node_index.
+  void Build(int node_index, int begin, int end);
+
+  // Calls @p on_lane for each lane whose box is accepted by @p accept_box, skipping the subtrees whose boxes are not.
+  template <typename AcceptBox, typename OnLane>
+  void Traverse(AcceptBox accept_box, OnLane on_lane) const;
+
+  const api::RoadGeometry* road_geometry_{};
+  // Lanes and their boxes, reordered so that each leaf holds a contiguous range.
+  std::vector<const api::Lane*> lanes_;
+  std::vector<AxisAlignedBox> lane_boxes_;
+  std::unordered_map<const api::Lane*, int> lane_indices_;
+  // Lanes in junction, segment and lane order, and the position of each lane in it.
+  std::vector<const api::Lane*> road_lanes_;
+  std::unordered_map<const api::Lane*, int> lane_orders_;
+  std::vector<Node> nodes_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,91 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_volume.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Rotation above which the sagitta is no longer bounded from the chord length.
+constexpr double kMaxChordRotation{3.14159265358979323846 / 2.};
+
+}  // namespace
+
+LaneCrossSection SampleLaneCrossSection(const api::Lane* lane, double s, const api::RBounds& r_bounds) {
+  MALIPUT_THROW_UNLESS(lane != nullptr);
+  LaneCrossSection cross_section;
+  cross_section.s = s;
+  int corner{0};
+  for (const double r : {r_bounds.min(), 0., r_bounds.max()}) {
+    const api::HBounds h_bounds = lane->elevation_bounds(s, r);
+    for (const double h : {h_bounds.min(), h_bounds.max()}) {
+      cross_section.lane_corners[corner] = api::LanePosition(s, r, h);
+      cross_section.corners[corner] = lane->ToInertialPosition(cross_section.lane_corners[corner]).xyz();
+      ++corner;
+    }
+  }
+  cross_section.rotation = lane->GetOrientation(api::LanePosition(s, 0., 0.));
+  return cross_section;
+}
+
+double ComputeLaneVolumeDeviation(const LaneCrossSection& first, const LaneCrossSection& second) {
+  // Longest chord, variation of the bounds and largest distance to the centerline of the corners.
+  double chord_length{0.};
+  double bounds_variation{0.};
+  double radius{0.};
+  for (int i = 0; i < LaneCrossSection::kNumCorners; ++i) {
+    const api::LanePosition& first_corner = first.lane_corners[i];
+    const api::LanePosition& second_corner = second.lane_corners[i];
+    chord_length = std::max(chord_length, (second.corners[i] - first.corners[i]).norm());
+    bounds_variation = std::max(bounds_variation, std::hypot(second_corner.r() - first_corner.r(),
+                                                             second_corner.h() - first_corner.h()));
+    radius = std::max({radius, std::hypot(first_corner.r(), first_corner.h()),
+                       std::hypot(second_corner.r(), second_corner.h())});
+  }
+  const double rotation = first.rotation.Distance(second.rotation);
+  // A point of an arc is at most half its length away from one of its ends. Arcs are at most `radius` * `rotation`
+  // longer than the centerline.
+  double sagitta = 0.5 * (std::abs(second.s - first.s) + radius * rotation);
+  if (rotation < kMaxChordRotation) {
+    // The tangents of an arc are within `rotation` of its chord, so it strays at most half the chord length times the
+    // tangent of `rotation` from it. The chords of the arcs at the sampled r and h coordinates differ from the ones
+    // between the corners by the variation of the bounds at each end.
+    sagitta = std::min(sagitta, 0.5 * (chord_length + 2. * bounds_variation) * std::tan(rotation));
+  }
+  return sagitta + bounds_variation;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,77 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <array>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace integration {
+
+/// Corners of the volume of a lane at a given s coordinate, as SampleLaneCrossSection() takes them.
+struct LaneCrossSection {
+  /// Number of corners: the lowest and highest elevation bounds at the minimum, zero and maximum r coordinates.
+  static constexpr int kNumCorners{6};
+
+  /// The s coordinate of the cross section.
+  double s{};
+  /// Lane positions of the corners.
+  std::array<api::LanePosition, kNumCorners> lane_corners;
+  /// Inertial positions of the corners.
+  std::array<math::Vector3, kNumCorners> corners;
+  /// Orientation of the lane frame at the centerline.
+  api::Rotation rotation;
+};
+
+/// Samples the cross section of the volume of `lane` at `s` that spans `r_bounds` and the elevation bounds.
+/// @param lane The lane to sample. It must not be nullptr.
+/// @param s The s coordinate to sample at.
+/// @param r_bounds The r coordinates the cross section spans, e.g. the lane or segment bounds at `s`.
+/// @returns The cross section.
+/// @throw maliput::common::assertion_error When `lane` is nullptr.
+LaneCrossSection SampleLaneCrossSection(const api::Lane* lane, double s, const api::RBounds& r_bounds);
+
+/// Bounds how far the volume of a lane between two of its cross sections strays from the convex hull of their corners.
+///
+/// Cross sections are planar, so the hull holds the chords between the corners of `first` and `second`. Between them,
+/// the lane sweeps arcs whose sagitta is bounded from the chord length and the rotation of the lane frame, which
+/// covers the outer edge of curves too, plus the variation of the bounds. It is only meaningful when the lane frame
+/// rotates monotonically between both cross sections, which holds for cross sections taken close enough.
+/// @param first The cross section at one end.
+/// @param second The cross section at the other end, sampled with the same kind of r bounds as `first`.
+/// @returns The maximum distance between a point of the lane volume between `first` and `second` and the convex hull of
+///          their corners.
+double ComputeLaneVolumeDeviation(const LaneCrossSection& first, const LaneCrossSection& second);
+
+}  // namespace integration
+}  // namespace maliput
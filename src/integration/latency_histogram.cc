@@ -0,0 +1,172 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Latencies below 2^kSubBucketBits ns are recorded exactly, larger ones keep their kSubBucketBits - 1 most
+// significant bits.
+constexpr int kSubBucketBits{7};
+constexpr std::int64_t kSubBucketCount{std::int64_t{1} << kSubBucketBits};
+constexpr std::int64_t kSubBucketHalfCount{kSubBucketCount / 2};
+// Latencies up to 2^kMaxValueBits ns, about 18 minutes, are bucketed; larger ones go to the last bucket.
+constexpr int kMaxValueBits{40};
+constexpr std::int64_t kMaxValue{(std::int64_t{1} << kMaxValueBits) - 1};
+constexpr double kNanosecondsPerSecond{1e9};
+
+// @returns The index of the most significant bit set in @p value.
+// @pre @p value is positive.
+int MostSignificantBit(std::int64_t value) {
+  int msb{0};
+  while (value >>= 1) {
+    ++msb;
+  }
+  return msb;
+}
+
+// @returns The index of the bucket @p value, in nanoseconds, falls in.
+std::size_t BucketIndex(std::int64_t value) {
+  if (value < kSubBucketCount) {
+    return static_cast<std::size_t>(value);
+  }
+  const int shift = MostSignificantBit(value) - (kSubBucketBits - 1);
+  return static_cast<std::size_t>(shift * kSubBucketHalfCount + (value >> shift));
+}
+
+// @returns The lowest value, in nanoseconds, of the bucket at @p index.
+std::int64_t BucketLowerBound(std::size_t index) {
+  const std::int64_t signed_index = static_cast<std::int64_t>(index);
+  if (signed_index < kSubBucketCount) {
+    return signed_index;
+  }
+  const std::int64_t shift = signed_index / kSubBucketHalfCount - 1;
+  return (signed_index - shift * kSubBucketHalfCount) << shift;
+}
+
+// @returns The highest value, in nanoseconds, of the bucket at @p index.
+std::int64_t BucketUpperBound(std::size_t index) { return BucketLowerBound(index + 1) - 1; }
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() : counts_(BucketIndex(kMaxValue) + 1, 0) {}
+
+void LatencyHistogram::Record(double seconds) {
+  const std::int64_t value = std::min(
+      kMaxValue, static_cast<std::int64_t>(std::llround(std::max(0., seconds) * kNanosecondsPerSecond)));
+  ++counts_[BucketIndex(value)];
+  ++count_;
+  sum_ += static_cast<double>(value);
+  max_ = std::max(max_, value);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+  for (std::size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+  max_ = std::max(max_, other.max_);
+}
+
+double LatencyHistogram::Percentile(double percentile) const {
+  MALIPUT_THROW_UNLESS(percentile >= 0. && percentile <= 100.);
+  if (count_ == 0) {
+    return 0.;
+  }
+  const std::uint64_t rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(std::ceil(percentile / 100. * static_cast<double>(count_))));
+  std::uint64_t accumulated{0};
+  for (std::size_t i = 0; i < counts_.size(); ++i) {
+    accumulated += counts_[i];
+    if (accumulated >= rank) {
+      return static_cast<double>(std::min(BucketUpperBound(i), max_)) / kNanosecondsPerSecond;
+    }
+  }
+  return static_cast<double>(max_) / kNanosecondsPerSecond;
+}
+
+LatencySummary LatencyHistogram::Summarize() const {
+  LatencySummary summary;
+  summary.count = count_;
+  if (count_ == 0) {
+    return summary;
+  }
+  summary.mean = sum_ / static_cast<double>(count_) / kNanosecondsPerSecond;
+  summary.p50 = Percentile(50.);
+  summary.p95 = Percentile(95.);
+  summary.p99 = Percentile(99.);
+  summary.max = static_cast<double>(max_) / kNanosecondsPerSecond;
+  return summary;
+}
+
+std::vector<LatencyHistogram::Bucket> LatencyHistogram::NonEmptyBuckets() const {
+  std::vector<Bucket> buckets;
+  for (std::size_t i = 0; i < counts_.size(); ++i) {
+    if (counts_[i] != 0) {
+      buckets.push_back({static_cast<double>(BucketLowerBound(i)) / kNanosecondsPerSecond,
+                         static_cast<double>(BucketUpperBound(i)) / kNanosecondsPerSecond, counts_[i]});
+    }
+  }
+  return buckets;
+}
+
+void WriteLatencyHistograms(const std::map<std::string, LatencyHistogram>& histograms, JsonWriter* writer) {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartObject();
+  for (const auto& name_histogram : histograms) {
+    const LatencySummary summary = name_histogram.second.Summarize();
+    writer->Key(name_histogram.first).StartObject();
+    writer->Key("count").Value(summary.count);
+    writer->Key("mean").Value(summary.mean);
+    writer->Key("p50").Value(summary.p50);
+    writer->Key("p95").Value(summary.p95);
+    writer->Key("p99").Value(summary.p99);
+    writer->Key("max").Value(summary.max);
+    writer->Key("buckets").StartArray();
+    for (const LatencyHistogram::Bucket& bucket : name_histogram.second.NonEmptyBuckets()) {
+      writer->StartObject();
+      writer->Key("lower").Value(bucket.lower).Key("upper").Value(bucket.upper).Key("count").Value(bucket.count);
+      writer->EndObject();
+    }
+    writer->EndArray();
+    writer->EndObject();
+  }
+  writer->EndObject();
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,112 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "integration/json_writer.h"
+
+namespace maliput {
+namespace integration {
+
+/// Summary of the latencies recorded by a LatencyHistogram, in seconds.
+struct LatencySummary {
+  /// Number of recorded latencies.
+  std::uint64_t count{0};
+  /// Arithmetic mean. It is exact, as it doesn't depend on the buckets.
+  double mean{0.};
+  /// 50th percentile.
+  double p50{0.};
+  /// 95th percentile.
+  double p95{0.};
+  /// 99th percentile.
+  double p99{0.};
+  /// Maximum latency. It is exact, as it doesn't depend on the buckets.
+  double max{0.};
+};
+
+/// Histogram of latencies with logarithmic buckets of linear sub-buckets, in the style of HdrHistogram.
+///
+/// Latencies are recorded with nanosecond resolution in O(1) and without allocating, so it is cheap enough to record
+/// every call of a hot path. Latencies below 128 ns are recorded exactly; larger ones are recorded into buckets whose
+/// width is at most 1/64 of their lower bound, which bounds the relative error of the percentiles to about 1.6%.
+/// Latencies beyond about 18 minutes are recorded in the last bucket.
+class LatencyHistogram {
+ public:
+  /// A bucket of the histogram. Bounds are in seconds.
+  struct Bucket {
+    double lower{0.};
+    double upper{0.};
+    std::uint64_t count{0};
+  };
+
+  LatencyHistogram();
+
+  /// Records a latency.
+  /// @param seconds The latency. Negative values are recorded as zero.
+  void Record(double seconds);
+
+  /// Adds the latencies recorded by `other`.
+  void Merge(const LatencyHistogram& other);
+
+  /// @returns The number of recorded latencies.
+  std::uint64_t count() const { return count_; }
+
+  /// Computes the `percentile`-th percentile of the recorded latencies, as the upper bound of the bucket it falls in.
+  /// @param percentile A value in the [0, 100] range.
+  /// @returns The percentile in seconds, or zero when no latency was recorded.
+  /// @throw maliput::common::assertion_error When `percentile` is out of range.
+  double Percentile(double percentile) const;
+
+  /// @returns The LatencySummary of the recorded latencies.
+  LatencySummary Summarize() const;
+
+  /// @returns The buckets holding at least one latency, in ascending order.
+  std::vector<Bucket> NonEmptyBuckets() const;
+
+ private:
+  std::vector<std::uint64_t> counts_;
+  std::uint64_t count_{0};
+  double sum_{0.};
+  std::int64_t max_{0};
+};
+
+/// Writes `histograms`, keyed by name, as a JSON object. Each member holds the LatencySummary fields and the
+/// non-empty buckets of a histogram.
+/// @param histograms The histograms to write.
+/// @param writer The writer to write to. It must not be nullptr.
+/// @throw maliput::common::assertion_error When `writer` is nullptr.
+void WriteLatencyHistograms(const std::map<std::string, LatencyHistogram>& histograms, JsonWriter* writer);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,131 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/memory_usage.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <string>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+std::atomic<std::uint64_t> allocation_count{0};
+std::atomic<std::uint64_t> allocation_bytes{0};
+std::atomic<std::uint64_t> free_count{0};
+std::atomic<std::uint64_t> free_bytes{0};
+std::atomic<std::uint64_t> peak_live_bytes{0};
+
+// @returns The number of live bytes according to the counters.
+std::uint64_t LiveBytes() {
+  const std::uint64_t freed = free_bytes.load(std::memory_order_relaxed);
+  const std::uint64_t allocated = allocation_bytes.load(std::memory_order_relaxed);
+  return allocated > freed ? allocated - freed : 0;
+}
+
+}  // namespace
+
+std::size_t GetCurrentResidentMemory() {
+  std::ifstream statm("/proc/self/statm");
+  std::size_t size_pages{0};
+  std::size_t resident_pages{0};
+  if (!(statm >> size_pages >> resident_pages)) {
+    return 0;
+  }
+  return resident_pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+std::size_t GetPeakResidentMemory() {
+  // VmHWM honours ResetPeakResidentMemory() while getrusage() always reports the peak since the process started.
+  std::ifstream status("/proc/self/status");
+  std::string key;
+  while (status >> key) {
+    if (key == "VmHWM:") {
+      std::size_t kilobytes{0};
+      if (status >> kilobytes) {
+        return kilobytes * 1024;
+      }
+      break;
+    }
+    status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  }
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+}
+
+bool ResetPeakResidentMemory() {
+  // See `man 5 proc`: writing 5 to /proc/[pid]/clear_refs resets the peak resident set size (Linux 4.0 and later).
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  if (!clear_refs.is_open()) {
+    return false;
+  }
+  clear_refs << "5";
+  clear_refs.flush();
+  return clear_refs.good();
+}
+
+void AllocationTracker::RecordAllocation(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+  const std::uint64_t live = LiveBytes();
+  std::uint64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void AllocationTracker::RecordDeallocation(std::size_t size) {
+  free_count.fetch_add(1, std::memory_order_relaxed);
+  free_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+AllocationStats AllocationTracker::Snapshot() {
+  return {allocation_count.load(std::memory_order_relaxed), allocation_bytes.load(std::memory_order_relaxed),
+          free_count.load(std::memory_order_relaxed), free_bytes.load(std::memory_order_relaxed),
+          peak_live_bytes.load(std::memory_order_relaxed)};
+}
+
+void AllocationTracker::ResetPeak() { peak_live_bytes.store(LiveBytes(), std::memory_order_relaxed); }
+
+AllocationStats operator-(const AllocationStats& end, const AllocationStats& start) {
+  const std::uint64_t start_live_bytes = start.bytes > start.free_bytes ? start.bytes - start.free_bytes : 0;
+  return {end.count - start.count, end.bytes - start.bytes, end.free_count - start.free_count,
+          end.free_bytes - start.free_bytes,
+          end.peak_live_bytes > start_live_bytes ? end.peak_live_bytes - start_live_bytes : 0};
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,92 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace maliput {
+namespace integration {
+
+/// @returns The resident set size of the current process in bytes, or zero when it is not available.
+std::size_t GetCurrentResidentMemory();
+
+/// @returns The peak resident set size of the current process in bytes, or zero when it is not available.
+/// The peak is measured since the process started or since the last successful call to ResetPeakResidentMemory().
+std::size_t GetPeakResidentMemory();
+
+/// Resets the peak resident set size of the current process to the current resident set size.
+/// @returns True when the kernel supports resetting it. Otherwise GetPeakResidentMemory() keeps reporting the peak
+/// since the process started.
+bool ResetPeakResidentMemory();
+
+/// Heap allocation counters.
+struct AllocationStats {
+  /// Number of allocations.
+  std::uint64_t count{0};
+  /// Number of bytes allocated.
+  std::uint64_t bytes{0};
+  /// Number of deallocations.
+  std::uint64_t free_count{0};
+  /// Number of bytes deallocated.
+  std::uint64_t free_bytes{0};
+  /// Maximum number of live bytes, i.e. allocated and not yet deallocated.
+  std::uint64_t peak_live_bytes{0};
+};
+
+/// Process-wide heap allocation counters.
+///
+/// The counters are only fed when the executable replaces the global `operator new` and `operator delete` and calls
+/// RecordAllocation() and RecordDeallocation() from them; otherwise they stay at zero. Counters are lock free and safe
+/// to update from multiple threads.
+class AllocationTracker {
+ public:
+  AllocationTracker() = delete;
+
+  /// Records an allocation of `size` bytes. It must not allocate.
+  static void RecordAllocation(std::size_t size);
+
+  /// Records a deallocation of `size` bytes. It must not allocate.
+  static void RecordDeallocation(std::size_t size);
+
+  /// @returns The counters accumulated so far.
+  static AllocationStats Snapshot();
+
+  /// Resets the peak of live bytes to the current number of live bytes, so that it tracks the peak from now on.
+  static void ResetPeak();
+};
+
+/// @returns The difference of the cumulative counters `end` minus `start`. `peak_live_bytes` is the growth of the peak
+/// of live bytes over the live bytes at `start`; it is meaningful when AllocationTracker::ResetPeak() was called at
+/// `start`.
+AllocationStats operator-(const AllocationStats& end, const AllocationStats& start);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,235 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/overlapping_lanes.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <future>
+#include <limits>
+
+#include <maliput/api/junction.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/math/bounding_box.h>
+
+#include "integration/lane_volume.h"
+#include "integration/thread_pool.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Number of chunks each worker gets on average, so that workers that finish early pick up more work.
+constexpr std::size_t kChunksPerThread{4};
+
+// Tolerance of the boxes that bound the lane pieces, the same maliput_query gives to the objects it queries.
+constexpr double kPieceTolerance{1e-6};
+
+// Maximum number of times a lane piece is halved, which bounds the work spent on regions that graze it.
+constexpr int kMaxPieceSplits{20};
+
+// @returns The number of intervals needed to split @p length in pieces not longer than @p sampling_step.
+int NumIntervals(double length, double sampling_step) {
+  return std::max(1, static_cast<int>(std::ceil(length / sampling_step)));
+}
+
+// Finds the lanes in [@p begin, @p end) of @p lanes classified as @p overlapping_type.
+std::vector<const api::Lane*> FindOverlappingLanesInRange(const std::vector<const api::Lane*>& lanes,
+                                                          std::size_t begin, std::size_t end,
+                                                          const math::BoundingRegion<math::Vector3>& region,
+                                                          math::OverlappingType overlapping_type,
+                                                          double sampling_step) {
+  std::vector<const api::Lane*> overlapping_lanes;
+  for (std::size_t i = begin; i < end; ++i) {
+    if (ComputeLaneOverlapping(lanes[i], region, sampling_step) == overlapping_type) {
+      overlapping_lanes.push_back(lanes[i]);
+    }
+  }
+  return overlapping_lanes;
+}
+
+// Piece of the volume of a lane between two cross sections.
+struct LanePiece {
+  LaneCrossSection first;
+  LaneCrossSection middle;
+  LaneCrossSection last;
+  // How far the piece strays from the convex hull of the corners of its cross sections.
+  double deviation{};
+};
+
+// @returns The piece of the volume of @p lane between @p first and @p last, sampled at its lane bounds.
+LanePiece MakeLanePiece(const api::Lane* lane, const LaneCrossSection& first, const LaneCrossSection& last) {
+  const double s = (first.s + last.s) / 2.;
+  LanePiece piece{first, SampleLaneCrossSection(lane, s, lane->lane_bounds(s)), last, 0.};
+  piece.deviation = std::max(ComputeLaneVolumeDeviation(piece.first, piece.middle),
+                             ComputeLaneVolumeDeviation(piece.middle, piece.last));
+  return piece;
+}
+
+// @returns The box bounding @p piece. It is aligned with the lane frame at the middle of the piece, holds the corners
+// of its cross sections and is grown by its deviation, so it contains the piece even where the lane curves or its
+// bounds vary. It is exact for straight lanes of constant bounds.
+math::BoundingBox MakeLanePieceBox(const LanePiece& piece) {
+  const api::Rotation& rotation = piece.middle.rotation;
+  const std::array<math::Vector3, 3> axes{rotation.Apply(api::InertialPosition(1., 0., 0.)).xyz(),
+                                          rotation.Apply(api::InertialPosition(0., 1., 0.)).xyz(),
+                                          rotation.Apply(api::InertialPosition(0., 0., 1.)).xyz()};
+  math::Vector3 center(0., 0., 0.);
+  math::Vector3 size(0., 0., 0.);
+  for (int i = 0; i < 3; ++i) {
+    double min_projection{std::numeric_limits<double>::infinity()};
+    double max_projection{-std::numeric_limits<double>::infinity()};
+    for (const LaneCrossSection* cross_section : {&piece.first, &piece.middle, &piece.last}) {
+      for (const math::Vector3& corner : cross_section->corners) {
+        min_projection = std::min(min_projection, corner.dot(axes[i]));
+        max_projection = std::max(max_projection, corner.dot(axes[i]));
+      }
+    }
+    center = center + (0.5 * (min_projection + max_projection)) * axes[i];
+    size[i] = max_projection - min_projection + 2. * piece.deviation;
+  }
+  return math::BoundingBox(center, size, rotation.rpy(), kPieceTolerance);
+}
+
+// Classifies how @p piece of @p lane overlaps @p region. Pieces whose box intersects @p region are halved until they
+// are told apart: the lane volume is connected, so it intersects @p region when some of its corners are inside of it
+// and others are not, or when the box is as tight as kPieceTolerance.
+math::OverlappingType ComputeLanePieceOverlapping(const api::Lane* lane,
+                                                  const math::BoundingRegion<math::Vector3>& region,
+                                                  const LanePiece& piece, int num_splits) {
+  const math::OverlappingType overlapping_type = region.Overlaps(MakeLanePieceBox(piece));
+  if (overlapping_type != math::OverlappingType::kIntersected) {
+    return overlapping_type;
+  }
+  bool any_inside{false};
+  bool any_outside{false};
+  for (const LaneCrossSection* cross_section : {&piece.first, &piece.middle, &piece.last}) {
+    for (const math::Vector3& corner : cross_section->corners) {
+      (region.Contains(corner) ? any_inside : any_outside) = true;
+    }
+  }
+  if ((any_inside && any_outside) || piece.deviation <= kPieceTolerance || num_splits == kMaxPieceSplits) {
+    return math::OverlappingType::kIntersected;
+  }
+  const math::OverlappingType first_half =
+      ComputeLanePieceOverlapping(lane, region, MakeLanePiece(lane, piece.first, piece.middle), num_splits + 1);
+  if (first_half == math::OverlappingType::kIntersected) {
+    return first_half;
+  }
+  const math::OverlappingType second_half =
+      ComputeLanePieceOverlapping(lane, region, MakeLanePiece(lane, piece.middle, piece.last), num_splits + 1);
+  return first_half == second_half ? first_half : math::OverlappingType::kIntersected;
+}
+
+}  // namespace
+
+math::OverlappingType ComputeLaneOverlapping(const api::Lane* lane, const math::BoundingRegion<math::Vector3>& region,
+                                             double sampling_step) {
+  MALIPUT_THROW_UNLESS(lane != nullptr);
+  MALIPUT_THROW_UNLESS(sampling_step > 0.);
+  bool any_contained{false};
+  bool any_disjointed{false};
+  const double length = lane->length();
+  const int num_pieces = NumIntervals(length, sampling_step);
+  LaneCrossSection first = SampleLaneCrossSection(lane, 0., lane->lane_bounds(0.));
+  for (int i = 1; i <= num_pieces; ++i) {
+    const double s = length * i / num_pieces;
+    const LaneCrossSection last = SampleLaneCrossSection(lane, s, lane->lane_bounds(s));
+    switch (ComputeLanePieceOverlapping(lane, region, MakeLanePiece(lane, first, last), 0)) {
+      case math::OverlappingType::kContained:
+        any_contained = true;
+        break;
+      case math::OverlappingType::kDisjointed:
+        any_disjointed = true;
+        break;
+      case math::OverlappingType::kIntersected:
+        return math::OverlappingType::kIntersected;
+    }
+    if (any_contained && any_disjointed) {
+      return math::OverlappingType::kIntersected;
+    }
+    first = last;
+  }
+  return any_contained ? math::OverlappingType::kContained : math::OverlappingType::kDisjointed;
+}
+
+std::vector<const api::Lane*> FindOverlappingLanesIn(const std::vector<const api::Lane*>& lanes,
+                                                     const math::BoundingRegion<math::Vector3>& region,
+                                                     math::OverlappingType overlapping_type, double sampling_step,
+                                                     ThreadPool* thread_pool) {
+  MALIPUT_THROW_UNLESS(sampling_step > 0.);
+  if (thread_pool == nullptr || thread_pool->num_threads() == 1 || lanes.size() <= 1) {
+    return FindOverlappingLanesInRange(lanes, 0, lanes.size(), region, overlapping_type, sampling_step);
+  }
+  const std::size_t num_chunks = static_cast<std::size_t>(thread_pool->num_threads()) * kChunksPerThread;
+  const std::size_t chunk_size = std::max<std::size_t>(1, (lanes.size() + num_chunks - 1) / num_chunks);
+  std::vector<std::future<std::vector<const api::Lane*>>> chunks;
+  for (std::size_t begin = 0; begin < lanes.size(); begin += chunk_size) {
+    const std::size_t end = std::min(lanes.size(), begin + chunk_size);
+    chunks.push_back(thread_pool->Submit([&lanes, begin, end, &region, overlapping_type, sampling_step]() {
+      return FindOverlappingLanesInRange(lanes, begin, end, region, overlapping_type, sampling_step);
+    }));
+  }
+  // All the chunks are waited for before rethrowing, as they reference this function's arguments.
+  for (auto& chunk : chunks) {
+    chunk.wait();
+  }
+  std::vector<const api::Lane*> overlapping_lanes;
+  for (auto& chunk : chunks) {
+    const std::vector<const api::Lane*> chunk_lanes = chunk.get();
+    overlapping_lanes.insert(overlapping_lanes.end(), chunk_lanes.begin(), chunk_lanes.end());
+  }
+  return overlapping_lanes;
+}
+
+std::vector<const api::Lane*> FindOverlappingLanesIn(const api::RoadGeometry* road_geometry,
+                                                     const math::BoundingRegion<math::Vector3>& region,
+                                                     math::OverlappingType overlapping_type, double sampling_step,
+                                                     ThreadPool* thread_pool) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(sampling_step > 0.);
+  // Lanes are walked in junction, segment and lane order so the result doesn't depend on hashing.
+  std::vector<const api::Lane*> lanes;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        lanes.push_back(segment->lane(k));
+      }
+    }
+  }
+  return FindOverlappingLanesIn(lanes, region, overlapping_type, sampling_step, thread_pool);
+}
+
+}  // namespace integration
+}  // namespace maliput
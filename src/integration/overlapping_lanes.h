@@ -0,0 +1,100 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/math/bounding_region.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/vector.h>
+
+namespace maliput {
+namespace integration {
+
+class ThreadPool;
+
+/// Classifies how the volume of `lane` overlaps `region`.
+///
+/// The lane volume spans its lane bounds and elevation bounds. It is split along the lane in pieces not longer than
+/// `sampling_step`, each one bounded by a math::BoundingBox aligned with the lane frame at its middle and grown by
+/// ComputeLaneVolumeDeviation(), so that it contains the piece where the lane curves or its bounds vary. Every piece
+/// is checked with math::BoundingRegion::Overlaps(). Pieces whose box intersects `region` are halved until their
+/// corners fall at both sides of `region` or their box is exact, so regions smaller than `sampling_step`, regions that
+/// overlap the lane volume but not its surface and regions that graze the outer edge of curves are classified too.
+///
+/// @param lane The lane to classify. It must not be nullptr.
+/// @param region The region to check the lane against. It must support math::BoundingRegion::Overlaps() with a
+///               math::BoundingBox.
+/// @param sampling_step Maximum length of the pieces. It must be positive.
+/// @returns math::OverlappingType::kContained when every piece is contained in `region`,
+///          math::OverlappingType::kDisjointed when every piece is disjointed from it, and
+///          math::OverlappingType::kIntersected otherwise.
+/// @throw maliput::common::assertion_error When `lane` is nullptr or `sampling_step` is not positive.
+math::OverlappingType ComputeLaneOverlapping(const api::Lane* lane, const math::BoundingRegion<math::Vector3>& region,
+                                             double sampling_step);
+
+/// Finds the lanes in `lanes` whose ComputeLaneOverlapping() classification is `overlapping_type`.
+///
+/// Lanes are classified independently, so when `thread_pool` is provided they are split in contiguous chunks that are
+/// classified concurrently by its workers. Chunk results are merged in chunk order, so the result is the same for any
+/// number of threads: lanes are listed in the order of `lanes`.
+///
+/// @param lanes The lanes to check. None of them can be nullptr.
+/// @param region The region to check the lanes against.
+/// @param overlapping_type The classification of the lanes to find.
+/// @param sampling_step Maximum length of the lane pieces. It must be positive.
+/// @param thread_pool Optional pool to run the classifications on.
+/// @returns The lanes classified as `overlapping_type`.
+/// @throw maliput::common::assertion_error When any of `lanes` is nullptr or `sampling_step` is not positive.
+std::vector<const api::Lane*> FindOverlappingLanesIn(const std::vector<const api::Lane*>& lanes,
+                                                     const math::BoundingRegion<math::Vector3>& region,
+                                                     math::OverlappingType overlapping_type, double sampling_step,
+                                                     ThreadPool* thread_pool = nullptr);
+
+/// Finds the lanes of `road_geometry` whose ComputeLaneOverlapping() classification is `overlapping_type`.
+///
+/// Lanes are listed in junction, segment and lane order. See the overload above for how `thread_pool` is used.
+///
+/// @param road_geometry The road geometry whose lanes are checked. It must not be nullptr.
+/// @param region The region to check the lanes against.
+/// @param overlapping_type The classification of the lanes to find.
+/// @param sampling_step Maximum length of the lane pieces. It must be positive.
+/// @param thread_pool Optional pool to run the classifications on.
+/// @returns The lanes classified as `overlapping_type`.
+/// @throw maliput::common::assertion_error When `road_geometry` is nullptr or `sampling_step` is not positive.
+std::vector<const api::Lane*> FindOverlappingLanesIn(const api::RoadGeometry* road_geometry,
+                                                     const math::BoundingRegion<math::Vector3>& region,
+                                                     math::OverlappingType overlapping_type, double sampling_step,
+                                                     ThreadPool* thread_pool = nullptr);
+
+}  // namespace integration
+}  // namespace maliput
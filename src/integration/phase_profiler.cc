@@ -0,0 +1,125 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_profiler.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Prints @p phase and its children into @p out, indented according to @p depth.
+void PrintPhase(const PhaseProfiler::Phase& phase, int depth, std::ostream* out) {
+  (*out) << std::string(2 * depth, ' ') << phase.name << ": " << phase.duration << " s";
+  if (phase.count > 1) {
+    (*out) << " (" << phase.count << " times)";
+  }
+  (*out) << std::endl;
+  for (const PhaseProfiler::Phase& child : phase.children) {
+    PrintPhase(child, depth + 1, out);
+  }
+}
+
+// Writes @p phase and its children as a JSON object into @p writer.
+void WritePhase(const PhaseProfiler::Phase& phase, JsonWriter* writer) {
+  writer->StartObject();
+  writer->Key("name").Value(phase.name);
+  writer->Key("duration").Value(phase.duration);
+  writer->Key("count").Value(phase.count);
+  writer->Key("children").StartArray();
+  for (const PhaseProfiler::Phase& child : phase.children) {
+    WritePhase(child, writer);
+  }
+  writer->EndArray();
+  writer->EndObject();
+}
+
+}  // namespace
+
+PhaseProfiler::ScopedPhase::ScopedPhase(PhaseProfiler* profiler, const std::string& name) : profiler_(profiler) {
+  if (profiler_ != nullptr) {
+    profiler_->Begin(name);
+  }
+}
+
+PhaseProfiler::ScopedPhase::~ScopedPhase() {
+  if (profiler_ != nullptr) {
+    profiler_->End();
+  }
+}
+
+void PhaseProfiler::Begin(const std::string& name) {
+  Phase* parent = open_phases_.empty() ? &root_ : open_phases_.back().phase;
+  auto it = std::find_if(parent->children.begin(), parent->children.end(),
+                         [&name](const Phase& phase) { return phase.name == name; });
+  if (it == parent->children.end()) {
+    parent->children.push_back(Phase{name, 0., 0, {}});
+    it = std::prev(parent->children.end());
+  }
+  // Pointers to the open phases remain valid: only the children of the innermost open phase can be modified and none
+  // of them is open.
+  open_phases_.push_back({&(*it), std::chrono::steady_clock::now()});
+}
+
+void PhaseProfiler::End() {
+  MALIPUT_THROW_UNLESS(!open_phases_.empty());
+  const OpenPhase& open_phase = open_phases_.back();
+  const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - open_phase.start;
+  open_phase.phase->duration += duration.count();
+  ++open_phase.phase->count;
+  open_phases_.pop_back();
+}
+
+void PhaseProfiler::Reset() {
+  MALIPUT_THROW_UNLESS(open_phases_.empty());
+  root_.children.clear();
+}
+
+void PhaseProfiler::Print(std::ostream* out) const {
+  MALIPUT_THROW_UNLESS(out != nullptr);
+  for (const Phase& phase : root_.children) {
+    PrintPhase(phase, 0, out);
+  }
+}
+
+void PhaseProfiler::WriteJson(JsonWriter* writer) const {
+  MALIPUT_THROW_UNLESS(writer != nullptr);
+  writer->StartArray();
+  for (const Phase& phase : root_.children) {
+    WritePhase(phase, writer);
+  }
+  writer->EndArray();
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,127 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/json_writer.h"
+
+namespace maliput {
+namespace integration {
+
+/// Records the wall time spent in named, possibly nested, phases of a process.
+///
+/// Phases are opened with Begin() and closed with End() (or more conveniently with a ScopedPhase). A phase opened
+/// while another one is open becomes its child. Phases with the same name and parent are merged: their durations are
+/// accumulated and their count is increased, so repeated steps (e.g. several resource lookups) show up as a single
+/// entry.
+///
+/// This class is not thread safe.
+class PhaseProfiler {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(PhaseProfiler)
+
+  /// A node of the phase tree.
+  struct Phase {
+    /// Name of the phase.
+    std::string name;
+    /// Accumulated duration in seconds.
+    double duration{0.};
+    /// Number of times the phase was run.
+    int count{0};
+    /// Nested phases, in order of first appearance.
+    std::vector<Phase> children;
+  };
+
+  /// Opens a phase on construction and closes it on destruction.
+  /// A nullptr profiler is allowed and makes this a no-op, so instrumented code does not need to check whether
+  /// profiling is enabled.
+  class ScopedPhase {
+   public:
+    MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedPhase)
+    ScopedPhase() = delete;
+
+    /// Constructs a ScopedPhase.
+    /// @param profiler PhaseProfiler to record into. It could be nullptr.
+    /// @param name Name of the phase.
+    ScopedPhase(PhaseProfiler* profiler, const std::string& name);
+
+    ~ScopedPhase();
+
+   private:
+    PhaseProfiler* profiler_{};
+  };
+
+  PhaseProfiler() = default;
+
+  /// Opens a phase named `name` as a child of the currently open phase, if any.
+  void Begin(const std::string& name);
+
+  /// Closes the most recently opened phase.
+  /// @throw maliput::common::assertion_error When there is no open phase.
+  void End();
+
+  /// Discards every recorded phase.
+  /// @throw maliput::common::assertion_error When there are open phases.
+  void Reset();
+
+  /// @returns The top level phases.
+  const std::vector<Phase>& phases() const { return root_.children; }
+
+  /// Prints the phase tree into `out`, one phase per line, indenting children below their parent.
+  /// @param out Stream to print to. It must not be nullptr.
+  /// @throw maliput::common::assertion_error When `out` is nullptr.
+  void Print(std::ostream* out) const;
+
+  /// Writes the phase tree as a JSON array of phase objects into `writer`.
+  /// @param writer JsonWriter to write to. It must not be nullptr.
+  /// @throw maliput::common::assertion_error When `writer` is nullptr.
+  void WriteJson(JsonWriter* writer) const;
+
+ private:
+  // An open phase and the time it was opened at.
+  struct OpenPhase {
+    Phase* phase{};
+    std::chrono::steady_clock::time_point start;
+  };
+
+  // Holds the top level phases as children.
+  Phase root_;
+  // Open phases, the innermost one last.
+  std::vector<OpenPhase> open_phases_;
+};
+
+}  // namespace integration
+}  // namespace maliput
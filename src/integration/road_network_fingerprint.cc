@@ -0,0 +1,198 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_network_fingerprint.h"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+
+#include <maliput/common/maliput_abort.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Incremental 64-bit FNV-1a hash.
+class Fnv1aHasher {
+ public:
+  void Update(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+      hash_ ^= static_cast<std::uint64_t>(bytes[i]);
+      hash_ *= kPrime;
+    }
+  }
+
+  void Update(std::uint64_t value) { Update(&value, sizeof(value)); }
+
+  void Update(int value) { Update(static_cast<std::uint64_t>(value)); }
+
+  void Update(bool value) { Update(static_cast<std::uint64_t>(value ? 1 : 0)); }
+
+  void Update(double value) {
+    std::uint64_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    Update(bits);
+  }
+
+  void Update(const std::optional<double>& value) {
+    Update(value.has_value());
+    if (value.has_value()) {
+      Update(value.value());
+    }
+  }
+
+  // The size is hashed first so that consecutive strings can't be confused with each other.
+  void Update(const std::string& value) {
+    Update(static_cast<std::uint64_t>(value.size()));
+    Update(value.data(), value.size());
+  }
+
+  std::uint64_t hash() const { return hash_; }
+
+ private:
+  static constexpr std::uint64_t kOffsetBasis{0xcbf29ce484222325ULL};
+  static constexpr std::uint64_t kPrime{0x100000001b3ULL};
+
+  std::uint64_t hash_{kOffsetBasis};
+};
+
+// Hashes the path GetResource() resolves @p file_name to and, when it exists, its contents, so that different
+// spellings of the same file share a fingerprint. Empty file names are hashed as such, given that they mean the file is
+// not used.
+void UpdateWithFile(const MaliputImplementation& maliput_implementation, const std::string& file_name,
+                    Fnv1aHasher* hasher) {
+  if (file_name.empty()) {
+    hasher->Update(file_name);
+    return;
+  }
+  const std::string file_path = GetResource(maliput_implementation, file_name);
+  hasher->Update(file_path);
+  std::ifstream file(file_path, std::ios::binary);
+  hasher->Update(file.is_open());
+  if (!file.is_open()) {
+    return;
+  }
+  std::array<char, 1 << 16> buffer{};
+  while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+    hasher->Update(buffer.data(), static_cast<std::size_t>(file.gcount()));
+  }
+}
+
+void UpdateWithBuildProperties(const DragwayBuildProperties& build_properties, Fnv1aHasher* hasher) {
+  hasher->Update(build_properties.num_lanes);
+  hasher->Update(build_properties.length);
+  hasher->Update(build_properties.lane_width);
+  hasher->Update(build_properties.shoulder_width);
+  hasher->Update(build_properties.maximum_height);
+}
+
+void UpdateWithBuildProperties(const MultilaneBuildProperties& build_properties, Fnv1aHasher* hasher) {
+  UpdateWithFile(MaliputImplementation::kMultilane, build_properties.yaml_file, hasher);
+}
+
+void UpdateWithBuildProperties(const MalidriveBuildProperties& build_properties, Fnv1aHasher* hasher) {
+  const MaliputImplementation maliput_implementation{MaliputImplementation::kMalidrive};
+  UpdateWithFile(maliput_implementation, build_properties.xodr_file_path, hasher);
+  hasher->Update(build_properties.linear_tolerance);
+  hasher->Update(build_properties.max_linear_tolerance);
+  // The build policy and the number of threads are left out, as they don't affect the resulting RoadNetwork.
+  hasher->Update(build_properties.simplification_policy);
+  hasher->Update(build_properties.standard_strictness_policy);
+  hasher->Update(build_properties.omit_nondrivable_lanes);
+  UpdateWithFile(maliput_implementation, build_properties.rule_registry_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.road_rule_book_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.traffic_light_book_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.phase_ring_book_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.intersection_book_file, hasher);
+  hasher->Update(build_properties.geometry_only);
+}
+
+void UpdateWithBuildProperties(const MaliputOsmBuildProperties& build_properties, Fnv1aHasher* hasher) {
+  const MaliputImplementation maliput_implementation{MaliputImplementation::kOsm};
+  UpdateWithFile(maliput_implementation, build_properties.osm_file, hasher);
+  hasher->Update(build_properties.linear_tolerance);
+  hasher->Update(build_properties.angular_tolerance);
+  hasher->Update(build_properties.origin.x());
+  hasher->Update(build_properties.origin.y());
+  UpdateWithFile(maliput_implementation, build_properties.rule_registry_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.road_rule_book_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.traffic_light_book_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.phase_ring_book_file, hasher);
+  UpdateWithFile(maliput_implementation, build_properties.intersection_book_file, hasher);
+  hasher->Update(build_properties.geometry_only);
+}
+
+}  // namespace
+
+std::uint64_t ComputeRoadNetworkFingerprint(MaliputImplementation maliput_implementation,
+                                            const DragwayBuildProperties& dragway_build_properties,
+                                            const MultilaneBuildProperties& multilane_build_properties,
+                                            const MalidriveBuildProperties& malidrive_build_properties,
+                                            const MaliputOsmBuildProperties& maliput_osm_build_properties) {
+  Fnv1aHasher hasher;
+  hasher.Update(kRoadNetworkFingerprintVersion);
+  hasher.Update(MaliputImplementationToString(maliput_implementation));
+  switch (maliput_implementation) {
+    case MaliputImplementation::kDragway:
+      UpdateWithBuildProperties(dragway_build_properties, &hasher);
+      break;
+    case MaliputImplementation::kMultilane:
+      UpdateWithBuildProperties(multilane_build_properties, &hasher);
+      break;
+    case MaliputImplementation::kMalidrive:
+      UpdateWithBuildProperties(malidrive_build_properties, &hasher);
+      break;
+    case MaliputImplementation::kOsm:
+      UpdateWithBuildProperties(maliput_osm_build_properties, &hasher);
+      break;
+    default:
+      MALIPUT_ABORT_MESSAGE("Error computing RoadNetwork fingerprint. Unknown implementation.");
+  }
+  return hasher.hash();
+}
+
+std::uint64_t ComputeRoadNetworkFingerprint(const RoadNetworkDescriptor& descriptor) {
+  return ComputeRoadNetworkFingerprint(descriptor.maliput_implementation, descriptor.dragway_build_properties,
+                                       descriptor.multilane_build_properties, descriptor.malidrive_build_properties,
+                                       descriptor.maliput_osm_build_properties);
+}
+
+std::string FingerprintToString(std::uint64_t fingerprint) {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << fingerprint;
+  return ss.str();
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,79 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+
+/// Version of the set of inputs hashed by ComputeRoadNetworkFingerprint().
+/// It is mixed into every fingerprint, so bumping it invalidates all the previously stored ones.
+constexpr std::uint64_t kRoadNetworkFingerprintVersion{4};
+
+/// Computes a fingerprint that identifies the api::RoadNetwork that LoadRoadNetwork() would build out of the
+/// same arguments.
+///
+/// Only the build properties of `maliput_implementation` are taken into account. Every field of them is hashed, except
+/// malidrive's build policy and number of threads, which change how the RoadNetwork is built but not its result. The
+/// files they point to (map file and rule / traffic light / phase ring / intersection books) are hashed by the path
+/// GetResource() resolves them to, so different spellings of the same file share a fingerprint, and by their contents.
+/// Consequently, editing any of those files changes the fingerprint, which allows callers that keep a built
+/// RoadNetwork, like RoadNetworkRegistry, to detect when it became stale.
+///
+/// @param maliput_implementation One of MaliputImplementation.
+/// @param dragway_build_properties Holds the properties to build a dragway RoadNetwork.
+/// @param multilane_build_properties Holds the properties to build a multilane RoadNetwork.
+/// @param malidrive_build_properties Holds the properties to build a malidrive RoadNetwork.
+/// @param maliput_osm_build_properties Holds the properties to build a maliput_osm RoadNetwork.
+/// @returns A 64-bit fingerprint.
+///
+/// @throw maliput::common::assertion_error When `maliput_implementation` is unknown.
+std::uint64_t ComputeRoadNetworkFingerprint(MaliputImplementation maliput_implementation,
+                                            const DragwayBuildProperties& dragway_build_properties,
+                                            const MultilaneBuildProperties& multilane_build_properties,
+                                            const MalidriveBuildProperties& malidrive_build_properties,
+                                            const MaliputOsmBuildProperties& maliput_osm_build_properties);
+
+/// Computes the ComputeRoadNetworkFingerprint() of the api::RoadNetwork `descriptor` describes.
+/// @param descriptor Describes the api::RoadNetwork.
+/// @returns A 64-bit fingerprint.
+///
+/// @throw maliput::common::assertion_error When `descriptor.maliput_implementation` is unknown.
+std::uint64_t ComputeRoadNetworkFingerprint(const RoadNetworkDescriptor& descriptor);
+
+/// @returns The zero-padded hexadecimal representation of `fingerprint`.
+std::string FingerprintToString(std::uint64_t fingerprint);
+
+}  // namespace integration
+}  // namespace maliput
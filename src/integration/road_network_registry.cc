@@ -0,0 +1,154 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_network_registry.h"
+
+#include <exception>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/road_network_fingerprint.h"
+
+namespace maliput {
+namespace integration {
+
+std::string RoadNetworkKey(const RoadNetworkDescriptor& descriptor) {
+  return FingerprintToString(ComputeRoadNetworkFingerprint(descriptor));
+}
+
+RoadNetworkRegistry::RoadNetworkRegistry()
+    : RoadNetworkRegistry([](const RoadNetworkDescriptor& descriptor) {
+        return LoadRoadNetwork(descriptor.maliput_implementation, descriptor.dragway_build_properties,
+                               descriptor.multilane_build_properties, descriptor.malidrive_build_properties,
+                               descriptor.maliput_osm_build_properties);
+      }) {}
+
+RoadNetworkRegistry::RoadNetworkRegistry(Loader loader)
+    : loader_(std::move(loader)), state_(std::make_shared<State>()) {
+  MALIPUT_THROW_UNLESS(loader_ != nullptr);
+}
+
+RoadNetworkRegistry& RoadNetworkRegistry::Global() {
+  static RoadNetworkRegistry registry;
+  return registry;
+}
+
+std::shared_ptr<const api::RoadNetwork> RoadNetworkRegistry::GetOrLoad(const RoadNetworkDescriptor& descriptor) {
+  const std::string key = RoadNetworkKey(descriptor);
+  std::promise<std::shared_ptr<const api::RoadNetwork>> promise;
+  std::shared_future<std::shared_ptr<const api::RoadNetwork>> pending;
+  bool build{false};
+  {
+    const std::lock_guard<std::mutex> lock(state_->mutex);
+    const auto it = state_->entries.find(key);
+    if (it != state_->entries.end()) {
+      if (std::shared_ptr<const api::RoadNetwork> road_network = it->second.road_network.lock()) {
+        return road_network;
+      }
+      pending = it->second.pending;
+    }
+    if (!pending.valid()) {
+      // Nobody is using nor building it, so this request builds it.
+      pending = promise.get_future().share();
+      state_->entries[key] = Entry{pending, {}};
+      build = true;
+    }
+  }
+  if (!build) {
+    // Another request is building it.
+    return pending.get();
+  }
+
+  std::shared_ptr<const api::RoadNetwork> road_network;
+  try {
+    std::unique_ptr<api::RoadNetwork> built_road_network = loader_(descriptor);
+    MALIPUT_THROW_UNLESS(built_road_network != nullptr);
+    const std::weak_ptr<State> state{state_};
+    road_network = std::shared_ptr<const api::RoadNetwork>(
+        built_road_network.release(),
+        [state, key](const api::RoadNetwork* road_network) { Evict(state, key, road_network); });
+  } catch (...) {
+    {
+      const std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->entries.erase(key);
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+  {
+    const std::lock_guard<std::mutex> lock(state_->mutex);
+    Entry& entry = state_->entries[key];
+    entry.road_network = road_network;
+    // Waiting requests hold their own copy of the future, so it can be released here.
+    entry.pending = {};
+  }
+  promise.set_value(road_network);
+  return road_network;
+}
+
+bool RoadNetworkRegistry::Contains(const RoadNetworkDescriptor& descriptor) const {
+  const std::string key = RoadNetworkKey(descriptor);
+  const std::lock_guard<std::mutex> lock(state_->mutex);
+  const auto it = state_->entries.find(key);
+  return it != state_->entries.end() && IsAlive(it->second);
+}
+
+int RoadNetworkRegistry::size() const {
+  const std::lock_guard<std::mutex> lock(state_->mutex);
+  int size{0};
+  for (const auto& key_entry : state_->entries) {
+    if (IsAlive(key_entry.second)) {
+      ++size;
+    }
+  }
+  return size;
+}
+
+void RoadNetworkRegistry::Evict(const std::weak_ptr<State>& state, const std::string& key,
+                                const api::RoadNetwork* road_network) {
+  delete road_network;
+  const std::shared_ptr<State> locked_state = state.lock();
+  if (locked_state == nullptr) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(locked_state->mutex);
+  const auto it = locked_state->entries.find(key);
+  // The entry may have been replaced by a new build in the meantime.
+  if (it != locked_state->entries.end() && !IsAlive(it->second)) {
+    locked_state->entries.erase(it);
+  }
+}
+
+bool RoadNetworkRegistry::IsAlive(const Entry& entry) {
+  return entry.pending.valid() || !entry.road_network.expired();
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,131 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <maliput/api/road_network.h>
+#include <maliput/common/maliput_copyable.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+
+/// Computes the key that identifies the api::RoadNetwork described by `descriptor` in a RoadNetworkRegistry.
+///
+/// The key is the ComputeRoadNetworkFingerprint() of `descriptor`, so:
+/// - the properties of the other implementations are ignored,
+/// - files are identified by the path GetResource() resolves them to, so different spellings of the same file share a
+///   key, and by their contents, so editing a map or rule file yields a new key,
+/// - properties that only affect how the map is built and not the result (e.g. the malidrive build policy and number
+///   of threads) are left out.
+///
+/// @param descriptor Describes the api::RoadNetwork.
+/// @returns The key.
+///
+/// @throw maliput::common::assertion_error When `descriptor.maliput_implementation` is unknown.
+std::string RoadNetworkKey(const RoadNetworkDescriptor& descriptor);
+
+/// Thread-safe registry that shares read-only api::RoadNetworks among their users.
+///
+/// GetOrLoad() builds each unique api::RoadNetwork, as identified by RoadNetworkKey(), exactly once, even when it is
+/// requested concurrently by several threads: the first request builds it while the others wait for the result. The
+/// registry doesn't own the api::RoadNetworks, it only tracks them, so an entry is evicted as soon as its last user
+/// releases it and a later request builds it again. Requests made after editing the files of an api::RoadNetwork build
+/// the edited one, while the users of the former keep it.
+///
+/// The handed out api::RoadNetworks may outlive the registry.
+class RoadNetworkRegistry {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(RoadNetworkRegistry)
+
+  /// Builds the api::RoadNetwork that a RoadNetworkDescriptor describes.
+  using Loader = std::function<std::unique_ptr<api::RoadNetwork>(const RoadNetworkDescriptor&)>;
+
+  /// Constructs a RoadNetworkRegistry that builds the api::RoadNetworks with LoadRoadNetwork().
+  RoadNetworkRegistry();
+
+  /// Constructs a RoadNetworkRegistry.
+  /// @param loader Builds the api::RoadNetworks. It must not be nullptr.
+  /// @throw maliput::common::assertion_error When `loader` is nullptr.
+  explicit RoadNetworkRegistry(Loader loader);
+
+  /// @returns The process-wide RoadNetworkRegistry.
+  static RoadNetworkRegistry& Global();
+
+  /// Obtains the api::RoadNetwork described by `descriptor`, building it when it isn't registered yet.
+  /// @param descriptor Describes the api::RoadNetwork.
+  /// @returns The shared api::RoadNetwork.
+  ///
+  /// @throw The exception thrown by the build when it fails. Concurrent requests waiting for that build get it as
+  ///        well. Failed builds aren't registered, so a later request tries again.
+  std::shared_ptr<const api::RoadNetwork> GetOrLoad(const RoadNetworkDescriptor& descriptor);
+
+  /// @returns True when the api::RoadNetwork described by `descriptor` is registered, i.e. it is being built or it
+  ///          has users.
+  bool Contains(const RoadNetworkDescriptor& descriptor) const;
+
+  /// @returns The number of registered api::RoadNetworks.
+  int size() const;
+
+ private:
+  // A registered RoadNetwork.
+  struct Entry {
+    // Holds the result of the build while it is in progress.
+    std::shared_future<std::shared_ptr<const api::RoadNetwork>> pending;
+    // The built RoadNetwork. It is not owned, so its last user evicts it.
+    std::weak_ptr<const api::RoadNetwork> road_network;
+  };
+
+  // State shared with the deleters of the handed out RoadNetworks, so they can evict their entry even when the
+  // registry is gone.
+  struct State {
+    std::mutex mutex;
+    std::map<std::string, Entry> entries;
+  };
+
+  // Deletes @p road_network and evicts the entry under @p key of @p state when it is still there.
+  static void Evict(const std::weak_ptr<State>& state, const std::string& key, const api::RoadNetwork* road_network);
+
+  // @returns True when @p entry is being built or it has users.
+  static bool IsAlive(const Entry& entry);
+
+  const Loader loader_;
+  const std::shared_ptr<State> state_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,105 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_position_batch.h"
+
+#include <algorithm>
+#include <future>
+#include <vector>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/thread_pool.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Number of chunks each worker gets on average, so that workers that finish early pick up more work.
+constexpr std::size_t kChunksPerThread{4};
+// Minimum number of positions per chunk, so that scheduling overhead doesn't dominate small inputs.
+constexpr std::size_t kMinChunkSize{256};
+
+// Projects the positions in the [@p begin, @p end) range.
+void ToRoadPositionsInRange(const api::RoadGeometry* road_geometry, const InertialPositionArrays& inertial_positions,
+                            std::size_t begin, std::size_t end, RoadPositionArrays* road_positions) {
+  for (std::size_t i = begin; i < end; ++i) {
+    const api::RoadPositionResult result = road_geometry->ToRoadPosition(
+        api::InertialPosition(inertial_positions.x[i], inertial_positions.y[i], inertial_positions.z[i]));
+    road_positions->lane[i] = result.road_position.lane;
+    road_positions->s[i] = result.road_position.pos.s();
+    road_positions->r[i] = result.road_position.pos.r();
+    road_positions->h[i] = result.road_position.pos.h();
+    road_positions->distance[i] = result.distance;
+  }
+}
+
+}  // namespace
+
+void ToRoadPositions(const api::RoadGeometry* road_geometry, const InertialPositionArrays& inertial_positions,
+                     RoadPositionArrays* road_positions, ThreadPool* thread_pool) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(road_positions != nullptr);
+  MALIPUT_THROW_UNLESS(road_positions->size >= inertial_positions.size);
+  const std::size_t size = inertial_positions.size;
+  if (size == 0) {
+    return;
+  }
+  MALIPUT_THROW_UNLESS(inertial_positions.x != nullptr && inertial_positions.y != nullptr &&
+                       inertial_positions.z != nullptr);
+  MALIPUT_THROW_UNLESS(road_positions->lane != nullptr && road_positions->s != nullptr &&
+                       road_positions->r != nullptr && road_positions->h != nullptr &&
+                       road_positions->distance != nullptr);
+
+  if (thread_pool == nullptr || thread_pool->num_threads() == 1 || size <= kMinChunkSize) {
+    ToRoadPositionsInRange(road_geometry, inertial_positions, 0, size, road_positions);
+    return;
+  }
+  const std::size_t num_chunks = static_cast<std::size_t>(thread_pool->num_threads()) * kChunksPerThread;
+  const std::size_t chunk_size = std::max(kMinChunkSize, (size + num_chunks - 1) / num_chunks);
+  std::vector<std::future<void>> chunks;
+  chunks.reserve((size + chunk_size - 1) / chunk_size);
+  for (std::size_t begin = 0; begin < size; begin += chunk_size) {
+    const std::size_t end = std::min(size, begin + chunk_size);
+    chunks.push_back(thread_pool->Submit([road_geometry, &inertial_positions, begin, end, road_positions]() {
+      ToRoadPositionsInRange(road_geometry, inertial_positions, begin, end, road_positions);
+    }));
+  }
+  // All the chunks are waited for before rethrowing, as they reference the caller's arrays.
+  for (std::future<void>& chunk : chunks) {
+    chunk.wait();
+  }
+  for (std::future<void>& chunk : chunks) {
+    chunk.get();
+  }
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,83 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/road_geometry.h>
+
+namespace maliput {
+namespace integration {
+
+class ThreadPool;
+
+/// Inertial positions laid out as a structure of arrays: the i-th position is (`x[i]`, `y[i]`, `z[i]`).
+///
+/// Arrays are not owned and must hold at least `size` elements each.
+struct InertialPositionArrays {
+  const double* x{nullptr};
+  const double* y{nullptr};
+  const double* z{nullptr};
+  std::size_t size{0};
+};
+
+/// Road positions laid out as a structure of arrays, as filled by ToRoadPositions().
+///
+/// Arrays are not owned and must hold at least `size` elements each.
+struct RoadPositionArrays {
+  /// Lanes the positions are on. Lanes are stored instead of their api::LaneId so no string is copied per position.
+  const api::Lane** lane{nullptr};
+  double* s{nullptr};
+  double* r{nullptr};
+  double* h{nullptr};
+  /// Distances between the inertial positions and their projections onto the road geometry.
+  double* distance{nullptr};
+  std::size_t size{0};
+};
+
+/// Projects `inertial_positions` onto `road_geometry`, as api::RoadGeometry::ToRoadPosition() does for a single
+/// position, and writes the results at the same indices of `road_positions`.
+///
+/// No memory is allocated per position. When `thread_pool` is provided, positions are split in contiguous chunks that
+/// are projected concurrently by its workers; otherwise they are projected by the calling thread.
+///
+/// @param road_geometry The road geometry to project onto. It must not be nullptr.
+/// @param inertial_positions The positions to project.
+/// @param road_positions The preallocated output arrays. It must not be nullptr and its `size` must not be smaller
+///        than the one of `inertial_positions`.
+/// @param thread_pool Optional pool to run the projections on.
+/// @throw maliput::common::assertion_error When any of the preconditions above is not met, or when an array is
+///        nullptr.
+void ToRoadPositions(const api::RoadGeometry* road_geometry, const InertialPositionArrays& inertial_positions,
+                     RoadPositionArrays* road_positions, ThreadPool* thread_pool = nullptr);
+
+}  // namespace integration
+}  // namespace maliput
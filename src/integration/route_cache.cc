@@ -0,0 +1,173 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/route_cache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <utility>
+
+#include <maliput/common/maliput_throw.h>
+
+#include "integration/route_tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The estimated memory usage, in bytes, of an entry under @p key that holds @p routes.
+std::size_t EstimateMemoryUsage(const std::string& key, const std::vector<api::LaneSRoute>& routes) {
+  // The entry, its list node and its index node, plus the key stored in both of them.
+  std::size_t memory_usage = sizeof(std::string) + 2 * key.size() + 4 * sizeof(void*) + sizeof(std::size_t) +
+                             sizeof(std::vector<api::LaneSRoute>) + routes.capacity() * sizeof(api::LaneSRoute);
+  for (const api::LaneSRoute& route : routes) {
+    memory_usage += route.ranges().capacity() * sizeof(api::LaneSRange);
+    for (const api::LaneSRange& range : route.ranges()) {
+      memory_usage += range.lane_id().string().size();
+    }
+  }
+  return memory_usage;
+}
+
+// @returns @p routes, starting at @p start and ending at @p end.
+std::vector<api::LaneSRoute> Adjust(const std::vector<api::LaneSRoute>& routes, const api::RoadPosition& start,
+                                    const api::RoadPosition& end) {
+  std::vector<api::LaneSRoute> adjusted_routes;
+  adjusted_routes.reserve(routes.size());
+  for (const api::LaneSRoute& route : routes) {
+    std::vector<api::LaneSRange> ranges = route.ranges();
+    if (!ranges.empty()) {
+      ranges.front() = api::LaneSRange(ranges.front().lane_id(),
+                                       api::SRange(start.pos.s(), ranges.front().s_range().s1()));
+      ranges.back() = api::LaneSRange(ranges.back().lane_id(), api::SRange(ranges.back().s_range().s0(), end.pos.s()));
+    }
+    adjusted_routes.emplace_back(ranges);
+  }
+  return adjusted_routes;
+}
+
+// Sorts @p routes in ascending length order, keeping the order of the routes of the same length.
+void SortByLength(std::vector<api::LaneSRoute>* routes) {
+  std::vector<std::pair<double, api::LaneSRoute>> length_routes;
+  length_routes.reserve(routes->size());
+  for (api::LaneSRoute& route : *routes) {
+    length_routes.emplace_back(GetLaneSRouteLength(route), std::move(route));
+  }
+  std::stable_sort(length_routes.begin(), length_routes.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  routes->clear();
+  for (auto& length_route : length_routes) {
+    routes->push_back(std::move(length_route.second));
+  }
+}
+
+}  // namespace
+
+RouteCache::RouteCache(std::size_t memory_budget, double s_bucket_size)
+    : memory_budget_(memory_budget), s_bucket_size_(s_bucket_size) {
+  MALIPUT_THROW_UNLESS(memory_budget_ > 0);
+  MALIPUT_THROW_UNLESS(s_bucket_size_ > 0.);
+}
+
+std::string RouteCache::Key(const api::RoadPosition& start, const api::RoadPosition& end, double max_length,
+                            std::optional<int> num_shortest_routes) const {
+  std::ostringstream key;
+  // Hexadecimal floats are exact, so that different maximum lengths never share a key.
+  key << start.lane->id().string() << '\n'
+      << end.lane->id().string() << '\n'
+      << static_cast<long long>(std::floor(start.pos.s() / s_bucket_size_)) << '\n'
+      << static_cast<long long>(std::floor(end.pos.s() / s_bucket_size_)) << '\n'
+      << std::hexfloat << max_length << '\n';
+  if (num_shortest_routes.has_value()) {
+    key << std::dec << *num_shortest_routes;
+  } else {
+    key << "all";
+  }
+  return key.str();
+}
+
+std::vector<api::LaneSRoute> RouteCache::GetOrDerive(const api::RoadPosition& start, const api::RoadPosition& end,
+                                                     double max_length, const Deriver& derive,
+                                                     std::optional<int> num_shortest_routes) {
+  MALIPUT_THROW_UNLESS(start.lane != nullptr);
+  MALIPUT_THROW_UNLESS(end.lane != nullptr);
+  MALIPUT_THROW_UNLESS(derive != nullptr);
+  MALIPUT_THROW_UNLESS(!num_shortest_routes.has_value() || *num_shortest_routes > 0);
+  const std::string key = Key(start, end, max_length, num_shortest_routes);
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = index_.find(key);
+    if (it != index_.end()) {
+      ++statistics_.hits;
+      entries_.splice(entries_.begin(), entries_, it->second);
+      std::vector<api::LaneSRoute> routes = Adjust(it->second->routes, start, end);
+      if (num_shortest_routes.has_value()) {
+        // Adjusting the first and last api::LaneSRanges changes the lengths, hence the ranking.
+        SortByLength(&routes);
+      }
+      return routes;
+    }
+    ++statistics_.misses;
+  }
+
+  std::vector<api::LaneSRoute> routes = derive(start, end, max_length);
+  const std::size_t memory_usage = EstimateMemoryUsage(key, routes);
+  if (memory_usage > memory_budget_) {
+    return routes;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  if (index_.find(key) == index_.end()) {
+    entries_.push_front(Entry{key, routes, memory_usage});
+    index_.emplace(key, entries_.begin());
+    statistics_.memory_usage += memory_usage;
+    Evict();
+  }
+  return routes;
+}
+
+void RouteCache::Evict() {
+  while (statistics_.memory_usage > memory_budget_) {
+    const Entry& entry = entries_.back();
+    statistics_.memory_usage -= entry.memory_usage;
+    index_.erase(entry.key);
+    entries_.pop_back();
+    ++statistics_.evictions;
+  }
+}
+
+RouteCache::Statistics RouteCache::statistics() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  Statistics statistics = statistics_;
+  statistics.entries = entries_.size();
+  return statistics;
+}
+
+}  // namespace integration
+}  // namespace maliput
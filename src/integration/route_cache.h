@@ -0,0 +1,142 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Thread-safe, least recently used cache of the routes between two positions.
+///
+/// Routes are stored under the lanes of their start and end positions, the buckets of `s_bucket_size` their s
+/// coordinates fall in, and their maximum length. The lanes a route goes through don't depend on where it starts and
+/// ends within its first and last lanes, so a hit is returned with its first and last api::LaneSRanges adjusted to the
+/// requested positions, without deriving the routes again.
+///
+/// Shortest routes, e.g. those of LaneGraph::DeriveShortestLaneSRoutes(), are stored under their number too, apart
+/// from the unranked ones. Their hits are sorted again by length once adjusted, but they are only the shortest ones
+/// among the routes derived for the positions that filled the entry: elsewhere in the buckets, a route that was not
+/// derived could be shorter. When the estimated memory usage of the entries exceeds the budget, the least recently used
+/// ones are evicted.
+class RouteCache {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(RouteCache)
+  RouteCache() = delete;
+
+  /// Derives the routes between two positions, with a maximum length.
+  using Deriver =
+      std::function<std::vector<api::LaneSRoute>(const api::RoadPosition&, const api::RoadPosition&, double)>;
+
+  /// Usage statistics of a RouteCache.
+  struct Statistics {
+    /// Number of lookups that found their routes.
+    std::size_t hits{0};
+    /// Number of lookups that had to derive their routes.
+    std::size_t misses{0};
+    /// Number of entries evicted to stay within the memory budget.
+    std::size_t evictions{0};
+    /// Number of entries.
+    std::size_t entries{0};
+    /// Estimated memory usage of the entries, in bytes.
+    std::size_t memory_usage{0};
+  };
+
+  /// Constructs a RouteCache.
+  /// @param memory_budget The maximum estimated memory usage of the entries, in bytes. It must be positive.
+  /// @param s_bucket_size The size of the buckets s coordinates are quantized into. It must be positive.
+  /// @throw maliput::common::assertion_error When `memory_budget` or `s_bucket_size` are not positive.
+  RouteCache(std::size_t memory_budget, double s_bucket_size);
+
+  /// Gets the routes from `start` to `end`, deriving them with `derive` on a miss.
+  ///
+  /// `derive` runs without holding the cache lock, so concurrent misses of the same entry derive it more than once.
+  /// @param start The position to start from. Its lane must not be nullptr.
+  /// @param end The position to end at. Its lane must not be nullptr.
+  /// @param max_length The maximum length of the intermediate lanes.
+  /// @param derive Derives the routes on a miss. It must not be nullptr.
+  /// @param num_shortest_routes When set, `derive` returns at most that many shortest routes, in ascending length
+  ///        order, and so do hits. Otherwise, the routes are not ranked. It must be positive when set.
+  /// @returns The routes, from `start` to `end`.
+  /// @throw maliput::common::assertion_error When the lanes of `start` or `end` or `derive` are nullptr, or
+  ///        `num_shortest_routes` is not positive.
+  std::vector<api::LaneSRoute> GetOrDerive(const api::RoadPosition& start, const api::RoadPosition& end,
+                                           double max_length, const Deriver& derive,
+                                           std::optional<int> num_shortest_routes = std::nullopt);
+
+  /// @returns The usage statistics.
+  Statistics statistics() const;
+
+  /// @returns The memory budget, in bytes.
+  std::size_t memory_budget() const { return memory_budget_; }
+
+  /// @returns The size of the s coordinate buckets.
+  double s_bucket_size() const { return s_bucket_size_; }
+
+ private:
+  // The routes of a key.
+  struct Entry {
+    std::string key;
+    std::vector<api::LaneSRoute> routes;
+    // Estimated memory usage of the entry, in bytes.
+    std::size_t memory_usage{};
+  };
+
+  // @returns The key of the routes from @p start to @p end with @p max_length, the @p num_shortest_routes shortest ones
+  // when set.
+  std::string Key(const api::RoadPosition& start, const api::RoadPosition& end, double max_length,
+                  std::optional<int> num_shortest_routes) const;
+
+  // Evicts the least recently used entries until the memory usage is within the budget. It must be called with
+  // `mutex_` held.
+  void Evict();
+
+  const std::size_t memory_budget_{};
+  const double s_bucket_size_{};
+  mutable std::mutex mutex_;
+  // Entries, from the most to the least recently used.
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  Statistics statistics_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,285 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/route_tools.h"
+
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <queue>
+#include <utility>
+
+#include <maliput/common/logger.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput/routing/derive_lane_s_routes.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Distances that differ by less than this, in meters, are considered equal.
+constexpr double kStitchTolerance{1e-6};
+
+// @returns Whether @p second continues @p first: both are on the same lane, @p second starts where @p first ends and
+// none of them goes backwards with respect to the other.
+bool Continues(const api::LaneSRange& first, const api::LaneSRange& second) {
+  if (first.lane_id() != second.lane_id()) {
+    return false;
+  }
+  const double first_delta = first.s_range().s1() - first.s_range().s0();
+  const double second_delta = second.s_range().s1() - second.s_range().s0();
+  return std::abs(first.s_range().s1() - second.s_range().s0()) < kStitchTolerance &&
+         first_delta * second_delta >= 0.;
+}
+
+// @returns The routes @p derive derives from @p start to @p end, looked up in @p route_cache first unless it is
+// nullptr. See RouteCache::GetOrDerive() for @p num_shortest_routes.
+std::vector<api::LaneSRoute> DeriveLeg(const api::RoadPosition& start, const api::RoadPosition& end, double max_length,
+                                       RouteCache* route_cache, const RouteCache::Deriver& derive,
+                                       std::optional<int> num_shortest_routes = std::nullopt) {
+  return route_cache != nullptr ? route_cache->GetOrDerive(start, end, max_length, derive, num_shortest_routes)
+                                : derive(start, end, max_length);
+}
+
+}  // namespace
+
+std::vector<api::RoadPosition> LocalizeWaypoints(const api::RoadGeometry* road_geometry,
+                                                 const std::vector<api::InertialPosition>& waypoints) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  std::vector<api::RoadPosition> road_positions;
+  road_positions.reserve(waypoints.size());
+  for (const api::InertialPosition& waypoint : waypoints) {
+    road_positions.push_back(road_geometry->ToRoadPosition(waypoint).road_position);
+  }
+  return road_positions;
+}
+
+api::LaneSRoute StitchLaneSRoutes(const api::LaneSRoute& first, const api::LaneSRoute& second) {
+  std::vector<api::LaneSRange> ranges = first.ranges();
+  auto it = second.ranges().begin();
+  if (!ranges.empty() && it != second.ranges().end() && Continues(ranges.back(), *it)) {
+    ranges.back() = api::LaneSRange(it->lane_id(), api::SRange(ranges.back().s_range().s0(), it->s_range().s1()));
+    ++it;
+  }
+  ranges.insert(ranges.end(), it, second.ranges().end());
+  return api::LaneSRoute(ranges);
+}
+
+std::vector<api::LaneSRoute> DeriveMultiWaypointLaneSRoutes(const std::vector<api::RoadPosition>& waypoints,
+                                                            double max_length, int max_num_routes,
+                                                            const LaneGraph* lane_graph, RouteCache* route_cache) {
+  MALIPUT_THROW_UNLESS(waypoints.size() >= 2);
+  MALIPUT_THROW_UNLESS(max_num_routes > 0);
+  std::vector<std::vector<api::LaneSRoute>> legs;
+  legs.reserve(waypoints.size() - 1);
+  for (std::size_t i = 0; i + 1 < waypoints.size(); ++i) {
+    legs.push_back(DeriveLeg(waypoints[i], waypoints[i + 1], max_length, route_cache,
+                             [lane_graph](const api::RoadPosition& start, const api::RoadPosition& end,
+                                          double leg_max_length) {
+                               return lane_graph != nullptr
+                                          ? lane_graph->DeriveLaneSRoutes(start, end, leg_max_length)
+                                          : maliput::routing::DeriveLaneSRoutes(start, end, leg_max_length);
+                             }));
+    maliput::log()->debug("Leg {} of {}: {} routes.", i + 1, waypoints.size() - 1, legs.back().size());
+    if (legs.back().empty()) {
+      return {};
+    }
+  }
+
+  std::vector<api::LaneSRoute> routes;
+  // Index of the route of each leg in the current combination, as the digits of a mixed radix number whose last leg is
+  // the least significant one.
+  std::vector<std::size_t> indices(legs.size(), 0);
+  while (static_cast<int>(routes.size()) < max_num_routes) {
+    api::LaneSRoute route = legs[0][indices[0]];
+    for (std::size_t i = 1; i < legs.size(); ++i) {
+      route = StitchLaneSRoutes(route, legs[i][indices[i]]);
+    }
+    routes.push_back(route);
+    // Moves to the next combination.
+    std::size_t leg = legs.size();
+    while (leg > 0 && ++indices[leg - 1] == legs[leg - 1].size()) {
+      indices[leg - 1] = 0;
+      --leg;
+    }
+    if (leg == 0) {
+      break;
+    }
+  }
+  return routes;
+}
+
+double GetLaneSRouteLength(const api::LaneSRoute& route) {
+  double length{0.};
+  for (const api::LaneSRange& range : route.ranges()) {
+    length += std::abs(range.s_range().s1() - range.s_range().s0());
+  }
+  return length;
+}
+
+std::vector<api::LaneSRoute> DeriveShortestMultiWaypointLaneSRoutes(const std::vector<api::RoadPosition>& waypoints,
+                                                                    double max_length, int max_num_routes,
+                                                                    const LaneGraph* lane_graph,
+                                                                    RouteCache* route_cache) {
+  MALIPUT_THROW_UNLESS(waypoints.size() >= 2);
+  MALIPUT_THROW_UNLESS(max_num_routes > 0);
+  MALIPUT_THROW_UNLESS(lane_graph != nullptr);
+  std::vector<std::vector<api::LaneSRoute>> legs;
+  std::vector<std::vector<double>> leg_lengths;
+  legs.reserve(waypoints.size() - 1);
+  leg_lengths.reserve(waypoints.size() - 1);
+  for (std::size_t i = 0; i + 1 < waypoints.size(); ++i) {
+    legs.push_back(DeriveLeg(waypoints[i], waypoints[i + 1], max_length, route_cache,
+                             [lane_graph, max_num_routes](const api::RoadPosition& start, const api::RoadPosition& end,
+                                                          double leg_max_length) {
+                               return lane_graph->DeriveShortestLaneSRoutes(start, end, leg_max_length,
+                                                                            max_num_routes);
+                             },
+                             max_num_routes));
+    maliput::log()->debug("Leg {} of {}: {} routes.", i + 1, waypoints.size() - 1, legs.back().size());
+    if (legs.back().empty()) {
+      return {};
+    }
+    leg_lengths.emplace_back();
+    for (const api::LaneSRoute& route : legs.back()) {
+      leg_lengths.back().push_back(GetLaneSRouteLength(route));
+    }
+  }
+
+  // Combinations hold the index of the route of each leg. They are enumerated best-first: as the routes of each leg
+  // are sorted, the successors of a combination, which advance one of its legs, are not shorter than it. Only the legs
+  // from the last advanced one on are advanced, so that every combination has a single predecessor.
+  struct Combination {
+    double length{};
+    std::vector<std::size_t> indices;
+    std::size_t last_advanced_leg{};
+    bool operator>(const Combination& other) const {
+      return length != other.length ? length > other.length : indices > other.indices;
+    }
+  };
+  std::priority_queue<Combination, std::vector<Combination>, std::greater<Combination>> combinations;
+  Combination first{0., std::vector<std::size_t>(legs.size(), 0), 0};
+  for (const std::vector<double>& lengths : leg_lengths) {
+    first.length += lengths.front();
+  }
+  combinations.push(first);
+
+  std::vector<api::LaneSRoute> routes;
+  while (!combinations.empty() && static_cast<int>(routes.size()) < max_num_routes) {
+    const Combination combination = combinations.top();
+    combinations.pop();
+    api::LaneSRoute route = legs[0][combination.indices[0]];
+    for (std::size_t i = 1; i < legs.size(); ++i) {
+      route = StitchLaneSRoutes(route, legs[i][combination.indices[i]]);
+    }
+    routes.push_back(route);
+    for (std::size_t leg = combination.last_advanced_leg; leg < legs.size(); ++leg) {
+      const std::size_t index = combination.indices[leg];
+      if (index + 1 == legs[leg].size()) {
+        continue;
+      }
+      Combination successor = combination;
+      successor.indices[leg] = index + 1;
+      successor.length += leg_lengths[leg][index + 1] - leg_lengths[leg][index];
+      successor.last_advanced_leg = leg;
+      combinations.push(std::move(successor));
+    }
+  }
+  return routes;
+}
+
+RouteJobResult RunRouteJob(const api::RoadGeometry* road_geometry, const RouteJob& job, int max_num_routes,
+                           const LaneGraph* lane_graph, RoutingMode routing_mode, RouteCache* route_cache) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(max_num_routes > 0);
+  MALIPUT_THROW_UNLESS(routing_mode == RoutingMode::kAll || lane_graph != nullptr);
+  RouteJobResult result;
+  if (job.waypoints.size() < 2) {
+    result.error = "At least two waypoints are required.";
+    return result;
+  }
+  try {
+    result.road_positions = LocalizeWaypoints(road_geometry, job.waypoints);
+    result.routes = routing_mode == RoutingMode::kAll
+                        ? DeriveMultiWaypointLaneSRoutes(result.road_positions, job.max_length, max_num_routes,
+                                                         lane_graph, route_cache)
+                        : DeriveShortestMultiWaypointLaneSRoutes(result.road_positions, job.max_length,
+                                                                 max_num_routes, lane_graph, route_cache);
+  } catch (const std::exception& e) {
+    result.error = e.what();
+  }
+  return result;
+}
+
+std::size_t RunRouteJobs(const api::RoadGeometry* road_geometry,
+                         const std::function<std::optional<RouteJob>()>& next_job, int max_num_routes,
+                         int max_in_flight, ThreadPool* thread_pool,
+                         const std::function<void(std::size_t, const RouteJob&, const RouteJobResult&)>& on_result,
+                         const LaneGraph* lane_graph, RoutingMode routing_mode, RouteCache* route_cache) {
+  MALIPUT_THROW_UNLESS(road_geometry != nullptr);
+  MALIPUT_THROW_UNLESS(max_num_routes > 0);
+  MALIPUT_THROW_UNLESS(max_in_flight > 0);
+  MALIPUT_THROW_UNLESS(routing_mode == RoutingMode::kAll || lane_graph != nullptr);
+  std::size_t num_jobs{0};
+  if (thread_pool == nullptr) {
+    for (std::optional<RouteJob> job = next_job(); job.has_value(); job = next_job()) {
+      const RouteJobResult result =
+          RunRouteJob(road_geometry, *job, max_num_routes, lane_graph, routing_mode, route_cache);
+      on_result(num_jobs++, *job, result);
+    }
+    return num_jobs;
+  }
+  // Jobs in submission order. The oldest one is waited for and handed over before a new one is pulled once the window
+  // is full, which keeps the results in order.
+  std::deque<std::pair<RouteJob, std::future<RouteJobResult>>> in_flight;
+  const auto hand_over_oldest = [&]() {
+    on_result(num_jobs++, in_flight.front().first, in_flight.front().second.get());
+    in_flight.pop_front();
+  };
+  for (std::optional<RouteJob> job = next_job(); job.has_value(); job = next_job()) {
+    if (static_cast<int>(in_flight.size()) == max_in_flight) {
+      hand_over_oldest();
+    }
+    std::future<RouteJobResult> result = thread_pool->Submit(
+        [road_geometry, job = *job, max_num_routes, lane_graph, routing_mode, route_cache]() {
+          return RunRouteJob(road_geometry, job, max_num_routes, lane_graph, routing_mode, route_cache);
+        });
+    in_flight.emplace_back(std::move(*job), std::move(result));
+  }
+  while (!in_flight.empty()) {
+    hand_over_oldest();
+  }
+  return num_jobs;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,180 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_geometry.h>
+
+#include "integration/lane_graph.h"
+#include "integration/route_cache.h"
+#include "integration/thread_pool.h"
+
+namespace maliput {
+namespace integration {
+
+/// Projects every waypoint in `waypoints` onto `road_geometry`, once.
+/// @param road_geometry The RoadGeometry to project onto. It must not be nullptr.
+/// @param waypoints The waypoints to project.
+/// @returns The api::RoadPositions of `waypoints`, in the same order.
+/// @throw maliput::common::assertion_error When `road_geometry` is nullptr.
+std::vector<api::RoadPosition> LocalizeWaypoints(const api::RoadGeometry* road_geometry,
+                                                 const std::vector<api::InertialPosition>& waypoints);
+
+/// Appends `second` to `first`.
+///
+/// When the last api::LaneSRange of `first` and the first one of `second` are on the same lane, the latter starts where
+/// the former ends and both advance in the same direction, they are merged into a single api::LaneSRange. That is the
+/// case of routes that meet at a waypoint.
+/// @param first The route to start with.
+/// @param second The route to continue with.
+/// @returns The stitched route.
+api::LaneSRoute StitchLaneSRoutes(const api::LaneSRoute& first, const api::LaneSRoute& second);
+
+/// Derives routes that go through all the `waypoints`, in order.
+///
+/// Each leg, between consecutive waypoints, is derived by maliput::routing::DeriveLaneSRoutes(), or by
+/// LaneGraph::DeriveLaneSRoutes() when `lane_graph` is provided. Then, each
+/// combination of one route per leg is stitched, see StitchLaneSRoutes(). Combinations are enumerated in
+/// lexicographic order of the leg routes, so the first route chains the first route of every leg.
+/// @param waypoints The waypoints to go through. There must be at least two, e.g. as LocalizeWaypoints() returns.
+/// @param max_length The maximum length of the intermediate lanes of each leg. See
+///        maliput::routing::DeriveLaneSRoutes().
+/// @param max_num_routes The maximum number of routes to return, as the number of combinations grows exponentially
+///        with the number of waypoints. It must be positive.
+/// @param lane_graph The LaneGraph of the road geometry of `waypoints`, to derive the legs on. When nullptr, the legs
+///        are derived by walking the api::BranchPoints.
+/// @param route_cache The RouteCache to look the legs up in, and to store them in when missing. It could be nullptr.
+/// @returns The routes. It is empty when any of the legs has no route.
+/// @throw maliput::common::assertion_error When there are less than two `waypoints` or `max_num_routes` is not
+///        positive.
+std::vector<api::LaneSRoute> DeriveMultiWaypointLaneSRoutes(const std::vector<api::RoadPosition>& waypoints,
+                                                            double max_length, int max_num_routes,
+                                                            const LaneGraph* lane_graph = nullptr,
+                                                            RouteCache* route_cache = nullptr);
+
+/// @returns The length of `route`, i.e. the sum of the lengths of its api::LaneSRanges.
+double GetLaneSRouteLength(const api::LaneSRoute& route);
+
+/// Derives the `max_num_routes` shortest routes that go through all the `waypoints`, in order.
+///
+/// The shortest routes of each leg, between consecutive waypoints, are derived by
+/// LaneGraph::DeriveShortestLaneSRoutes(). Then, their combinations are stitched, see StitchLaneSRoutes(), in ascending
+/// order of their total length. Only the `max_num_routes` shortest routes of each leg are needed for that.
+/// @param waypoints The waypoints to go through. There must be at least two, e.g. as LocalizeWaypoints() returns.
+/// @param max_length The maximum length of the intermediate lanes of each leg. See LaneGraph::FindLaneSequences().
+/// @param max_num_routes The maximum number of routes to return. It must be positive.
+/// @param lane_graph The LaneGraph of the road geometry of `waypoints`. It must not be nullptr.
+/// @param route_cache The RouteCache to look the legs up in, and to store them in when missing. It could be nullptr.
+///        Cached legs are only the shortest ones for the positions they were derived for, see RouteCache.
+/// @returns The shortest routes, in ascending length order. It is empty when any of the legs has no route.
+/// @throw maliput::common::assertion_error When there are less than two `waypoints`, `max_num_routes` is not positive
+///        or `lane_graph` is nullptr.
+std::vector<api::LaneSRoute> DeriveShortestMultiWaypointLaneSRoutes(const std::vector<api::RoadPosition>& waypoints,
+                                                                    double max_length, int max_num_routes,
+                                                                    const LaneGraph* lane_graph,
+                                                                    RouteCache* route_cache = nullptr);
+
+/// How routes are derived.
+enum class RoutingMode {
+  /// All the routes, see DeriveMultiWaypointLaneSRoutes().
+  kAll,
+  /// The shortest routes, in ascending length order, see DeriveShortestMultiWaypointLaneSRoutes().
+  kShortest,
+};
+
+/// A route derivation job.
+struct RouteJob {
+  /// The waypoints to go through, in order. There must be at least two.
+  std::vector<api::InertialPosition> waypoints;
+  /// The maximum length of the intermediate lanes of each leg. See DeriveMultiWaypointLaneSRoutes().
+  double max_length{};
+};
+
+/// The result of a RouteJob.
+struct RouteJobResult {
+  /// The api::RoadPositions of the waypoints.
+  std::vector<api::RoadPosition> road_positions;
+  /// The derived routes.
+  std::vector<api::LaneSRoute> routes;
+  /// Why the job failed. It is empty when it succeeded, even if no route was found.
+  std::string error;
+};
+
+/// Runs `job`: localizes its waypoints and derives the routes that go through them, see LocalizeWaypoints() and
+/// DeriveMultiWaypointLaneSRoutes().
+/// @param road_geometry The RoadGeometry to route on. It must not be nullptr.
+/// @param job The job to run.
+/// @param max_num_routes The maximum number of routes to derive. It must be positive.
+/// @param lane_graph The LaneGraph of `road_geometry`, to derive the routes on. It could be nullptr when `routing_mode`
+///        is RoutingMode::kAll.
+/// @param routing_mode Which routes to derive.
+/// @param route_cache The RouteCache of the legs. It could be nullptr.
+/// @returns The result of `job`. Errors, e.g. less than two waypoints, are reported in RouteJobResult::error rather
+///          than thrown.
+/// @throw maliput::common::assertion_error When `road_geometry` is nullptr, `max_num_routes` is not positive or
+///        `lane_graph` is nullptr and `routing_mode` is not RoutingMode::kAll.
+RouteJobResult RunRouteJob(const api::RoadGeometry* road_geometry, const RouteJob& job, int max_num_routes,
+                           const LaneGraph* lane_graph = nullptr, RoutingMode routing_mode = RoutingMode::kAll,
+                           RouteCache* route_cache = nullptr);
+
+/// Runs the jobs `next_job` provides on `thread_pool` and hands their results to `on_result`, in job order.
+///
+/// At most `max_in_flight` jobs are pending or running at any time, so memory does not grow with the number of jobs:
+/// jobs are pulled and results are pushed as they go.
+/// @param road_geometry The RoadGeometry to route on. It must not be nullptr.
+/// @param next_job Provides the next job to run, or std::nullopt when there are no more jobs. It is only called from
+///        the calling thread.
+/// @param max_num_routes The maximum number of routes to derive per job. It must be positive.
+/// @param max_in_flight The maximum number of jobs that are pending or running. It must be positive.
+/// @param thread_pool The ThreadPool to run the jobs on. When nullptr, jobs run on the calling thread.
+/// @param on_result Called, on the calling thread, with the index of every job, the job and its result.
+/// @param lane_graph The LaneGraph of `road_geometry`, to derive the routes on. It could be nullptr when `routing_mode`
+///        is RoutingMode::kAll. It is shared by all the jobs.
+/// @param routing_mode Which routes to derive.
+/// @param route_cache The RouteCache of the legs. It could be nullptr. It is shared by all the jobs.
+/// @returns The number of jobs that ran.
+/// @throw maliput::common::assertion_error When `road_geometry` is nullptr, `max_num_routes` or `max_in_flight` are
+///        not positive, or `lane_graph` is nullptr and `routing_mode` is not RoutingMode::kAll.
+std::size_t RunRouteJobs(const api::RoadGeometry* road_geometry,
+                         const std::function<std::optional<RouteJob>()>& next_job, int max_num_routes,
+                         int max_in_flight, ThreadPool* thread_pool,
+                         const std::function<void(std::size_t, const RouteJob&, const RouteJobResult&)>& on_result,
+                         const LaneGraph* lane_graph = nullptr, RoutingMode routing_mode = RoutingMode::kAll,
+                         RouteCache* route_cache = nullptr);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,82 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/scaling.h"
+
+#include <algorithm>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+ScalingReport ComputeScalingReport(double baseline_time, const std::vector<int>& num_threads,
+                                   const std::vector<double>& times) {
+  MALIPUT_THROW_UNLESS(baseline_time > 0.);
+  MALIPUT_THROW_UNLESS(!num_threads.empty());
+  MALIPUT_THROW_UNLESS(num_threads.size() == times.size());
+
+  ScalingReport report;
+  report.baseline_time = baseline_time;
+  for (std::size_t i = 0; i < num_threads.size(); ++i) {
+    MALIPUT_THROW_UNLESS(num_threads[i] > 0);
+    MALIPUT_THROW_UNLESS(times[i] > 0.);
+    const double speedup = baseline_time / times[i];
+    report.points.push_back({num_threads[i], times[i], speedup, speedup / num_threads[i]});
+  }
+  std::sort(report.points.begin(), report.points.end(),
+            [](const ScalingPoint& lhs, const ScalingPoint& rhs) { return lhs.num_threads < rhs.num_threads; });
+  for (std::size_t i = 1; i < report.points.size(); ++i) {
+    MALIPUT_THROW_UNLESS(report.points[i - 1].num_threads != report.points[i].num_threads);
+  }
+
+  const ScalingPoint& first = report.points.front();
+  const ScalingPoint& last = report.points.back();
+  const double threads_range = static_cast<double>(last.num_threads - first.num_threads);
+  const auto [min_speedup_it, max_speedup_it] =
+      std::minmax_element(report.points.begin(), report.points.end(),
+                          [](const ScalingPoint& lhs, const ScalingPoint& rhs) { return lhs.speedup < rhs.speedup; });
+  const double speedup_range = max_speedup_it->speedup - min_speedup_it->speedup;
+  if (threads_range <= 0. || speedup_range <= 0.) {
+    return report;
+  }
+  double max_difference = 0.;
+  for (std::size_t i = 0; i < report.points.size(); ++i) {
+    const double normalized_threads = (report.points[i].num_threads - first.num_threads) / threads_range;
+    const double normalized_speedup = (report.points[i].speedup - min_speedup_it->speedup) / speedup_range;
+    if (normalized_speedup - normalized_threads > max_difference) {
+      max_difference = normalized_speedup - normalized_threads;
+      report.knee_index = static_cast<int>(i);
+    }
+  }
+  return report;
+}
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,78 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+namespace maliput {
+namespace integration {
+
+/// Measurement of a workload run with a given number of threads, compared to a sequential baseline.
+struct ScalingPoint {
+  /// Number of threads.
+  int num_threads{1};
+  /// Time in seconds.
+  double time{0.};
+  /// Baseline time divided by `time`.
+  double speedup{0.};
+  /// `speedup` divided by `num_threads`.
+  double efficiency{0.};
+};
+
+/// Scaling of a workload with the number of threads.
+struct ScalingReport {
+  /// Time in seconds of the sequential run every point is compared to.
+  double baseline_time{0.};
+  /// Points sorted by number of threads.
+  std::vector<ScalingPoint> points;
+  /// Index in `points` of the knee of the speedup curve: the number of threads beyond which adding threads yields
+  /// diminishing returns.
+  int knee_index{0};
+};
+
+/// Computes the ScalingReport of a workload.
+///
+/// The knee is located with the Kneedle method: both the number of threads and the speedup are normalized to the
+/// [0, 1] range and the knee is the point that maximizes the difference between the normalized speedup and the
+/// normalized number of threads, i.e. the point farthest above the straight line that joins the first and the last
+/// points.
+///
+/// @param baseline_time Time in seconds of the sequential run. It must be positive.
+/// @param num_threads Number of threads of each parallel run. It must not be empty and its values must be positive
+///                    and unique.
+/// @param times Time in seconds of each parallel run, matching `num_threads`. Values must be positive.
+/// @returns The ScalingReport.
+///
+/// @throw maliput::common::assertion_error When preconditions are not met.
+ScalingReport ComputeScalingReport(double baseline_time, const std::vector<int>& num_threads,
+                                   const std::vector<double>& times);
+
+}  // namespace integration
+}  // namespace maliput
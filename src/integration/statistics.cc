@@ -0,0 +1,103 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/statistics.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Two-sided 95% critical values of the Student's t distribution for 1 to 30 degrees of freedom.
+constexpr std::array<double, 30> kStudentT95{12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                             2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                             2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+// Two-sided 95% critical value of the normal distribution, used beyond the tabulated degrees of freedom.
+constexpr double kNormal95{1.960};
+
+// @returns The two-sided 95% critical value for @p degrees_of_freedom.
+double CriticalValue95(int degrees_of_freedom) {
+  return degrees_of_freedom <= static_cast<int>(kStudentT95.size()) ? kStudentT95[degrees_of_freedom - 1] : kNormal95;
+}
+
+// @returns The @p percentile -th percentile of @p sorted_samples.
+// @pre @p sorted_samples is sorted in ascending order and is not empty.
+double SortedPercentile(const std::vector<double>& sorted_samples, double percentile) {
+  const double rank = percentile / 100. * static_cast<double>(sorted_samples.size() - 1);
+  const std::size_t lower_index = static_cast<std::size_t>(std::floor(rank));
+  const std::size_t upper_index = std::min(lower_index + 1, sorted_samples.size() - 1);
+  const double fraction = rank - static_cast<double>(lower_index);
+  return sorted_samples[lower_index] + fraction * (sorted_samples[upper_index] - sorted_samples[lower_index]);
+}
+
+}  // namespace
+
+double Percentile(std::vector<double> samples, double percentile) {
+  MALIPUT_THROW_UNLESS(!samples.empty());
+  MALIPUT_THROW_UNLESS(percentile >= 0. && percentile <= 100.);
+  std::sort(samples.begin(), samples.end());
+  return SortedPercentile(samples, percentile);
+}
+
+SampleStatistics ComputeSampleStatistics(const std::vector<double>& samples) {
+  MALIPUT_THROW_UNLESS(!samples.empty());
+  std::vector<double> sorted_samples{samples};
+  std::sort(sorted_samples.begin(), sorted_samples.end());
+
+  SampleStatistics statistics;
+  statistics.count = static_cast<int>(sorted_samples.size());
+  statistics.min = sorted_samples.front();
+  statistics.max = sorted_samples.back();
+  statistics.mean = std::accumulate(sorted_samples.begin(), sorted_samples.end(), 0.) / statistics.count;
+  statistics.median = SortedPercentile(sorted_samples, 50.);
+  statistics.p90 = SortedPercentile(sorted_samples, 90.);
+  statistics.p99 = SortedPercentile(sorted_samples, 99.);
+  if (statistics.count > 1) {
+    double squared_deviations{0.};
+    for (const double sample : sorted_samples) {
+      squared_deviations += (sample - statistics.mean) * (sample - statistics.mean);
+    }
+    statistics.stddev = std::sqrt(squared_deviations / (statistics.count - 1));
+  }
+  const double half_width = statistics.count > 1 ? CriticalValue95(statistics.count - 1) * statistics.stddev /
+                                                        std::sqrt(static_cast<double>(statistics.count))
+                                                  : 0.;
+  statistics.ci95_low = statistics.mean - half_width;
+  statistics.ci95_high = statistics.mean + half_width;
+  return statistics;
+}
+
+}  // namespace integration
+}  // namespace maliput
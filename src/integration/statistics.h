@@ -0,0 +1,79 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+namespace maliput {
+namespace integration {
+
+/// Summary statistics of a set of samples, e.g. the durations of repeated measurements.
+struct SampleStatistics {
+  /// Number of samples.
+  int count{0};
+  /// Minimum value.
+  double min{0.};
+  /// Maximum value.
+  double max{0.};
+  /// Arithmetic mean.
+  double mean{0.};
+  /// 50th percentile.
+  double median{0.};
+  /// 90th percentile.
+  double p90{0.};
+  /// 99th percentile.
+  double p99{0.};
+  /// Sample (Bessel-corrected) standard deviation. Zero when there is a single sample.
+  double stddev{0.};
+  /// Lower bound of the 95% confidence interval of the mean.
+  double ci95_low{0.};
+  /// Upper bound of the 95% confidence interval of the mean.
+  double ci95_high{0.};
+};
+
+/// Computes the `percentile`-th percentile of `samples`, linearly interpolating between the closest ranks.
+/// @param samples Samples to evaluate. They don't need to be sorted. It must not be empty.
+/// @param percentile A value in the [0, 100] range.
+/// @returns The percentile value.
+///
+/// @throw maliput::common::assertion_error When `samples` is empty or `percentile` is out of range.
+double Percentile(std::vector<double> samples, double percentile);
+
+/// Computes the SampleStatistics of `samples`.
+/// The confidence interval of the mean relies on the Student's t distribution, so it is meaningful for small sample
+/// sizes too.
+/// @param samples Samples to evaluate. They don't need to be sorted. It must not be empty.
+/// @returns The SampleStatistics of `samples`.
+///
+/// @throw maliput::common::assertion_error When `samples` is empty.
+SampleStatistics ComputeSampleStatistics(const std::vector<double>& samples);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,272 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/synthetic_road_network.h"
+
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <maliput/common/logger.h>
+#include <maliput/common/maliput_throw.h>
+#include <maliput_multilane/road_network_builder.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+constexpr double kPi{3.14159265358979323846};
+
+// Direction of a road leaving an intersection.
+enum class Direction { kEast, kNorth, kWest, kSouth };
+
+constexpr Direction kDirections[]{Direction::kEast, Direction::kNorth, Direction::kWest, Direction::kSouth};
+
+// @returns The heading, in degrees, of @p direction.
+double Heading(Direction direction) { return 90. * static_cast<int>(direction); }
+
+// @returns The letter naming @p direction.
+char Letter(Direction direction) {
+  static constexpr char kLetters[]{'e', 'n', 'w', 's'};
+  return kLetters[static_cast<int>(direction)];
+}
+
+// @returns The column and row offsets to the intersection @p direction leads to.
+std::pair<int, int> Offset(Direction direction) {
+  switch (direction) {
+    case Direction::kEast:
+      return {1, 0};
+    case Direction::kNorth:
+      return {0, 1};
+    case Direction::kWest:
+      return {-1, 0};
+    case Direction::kSouth:
+      return {0, -1};
+  }
+  MALIPUT_THROW_MESSAGE("Unknown Direction value.");
+}
+
+// @returns The number of quarter turns, counterclockwise, from @p from to @p to.
+int QuarterTurns(Direction from, Direction to) { return (static_cast<int>(to) - static_cast<int>(from) + 4) % 4; }
+
+// Start pose of a connection, in the inertial frame.
+struct Pose {
+  double x{0.};
+  double y{0.};
+  // In degrees.
+  double heading{0.};
+};
+
+// Describes the grid as maliput_multilane YAML.
+//
+// Connections' reference curves are the centerlines of their lane 0, the rightmost one, so that every lane of a
+// connection starts where the same lane of the connections it follows ends. Roads in opposite directions share their
+// axis: the lanes of each direction are to the right of it.
+class SyntheticYamlGenerator {
+ public:
+  explicit SyntheticYamlGenerator(const SyntheticRoadNetworkProperties& properties)
+      : properties_(properties),
+        // Distance from the road axis to the centerline of lane 0.
+        lane_0_offset_(properties.two_way ? (properties.num_lanes - 0.5) * properties.lane_width
+                                          : 0.5 * (properties.num_lanes - 1) * properties.lane_width),
+        // Distance from the center of an intersection to where roads start, beyond the crossing roads' lanes.
+        inset_((properties.two_way ? properties.num_lanes : 0.5 * properties.num_lanes) * properties.lane_width +
+               properties.lane_width) {
+    MALIPUT_THROW_UNLESS(properties_.rows > 0);
+    MALIPUT_THROW_UNLESS(properties_.columns > 0);
+    MALIPUT_THROW_UNLESS(properties_.rows * properties_.columns > 1);
+    MALIPUT_THROW_UNLESS(properties_.num_lanes > 0);
+    MALIPUT_THROW_UNLESS(properties_.lane_width > 0.);
+    MALIPUT_THROW_UNLESS(properties_.block_length > 2. * inset_);
+  }
+
+  std::string Generate() {
+    for (int column = 0; column < properties_.columns; ++column) {
+      for (int row = 0; row < properties_.rows; ++row) {
+        AddRoads(column, row);
+        AddIntersection(column, row);
+      }
+    }
+    std::ostringstream out;
+    out << std::setprecision(12);
+    out << "# Synthetic " << properties_.rows << "x" << properties_.columns << " grid of roads.\n";
+    out << "maliput_multilane_builder:\n";
+    out << "  id: \"synthetic_" << properties_.rows << "x" << properties_.columns << "\"\n";
+    out << "  computation_policy: \"prefer-speed\"\n";
+    out << "  scale_length: 1.0\n";
+    out << "  lane_width: " << properties_.lane_width << "\n";
+    out << "  left_shoulder: 0.\n";
+    out << "  right_shoulder: 0.\n";
+    out << "  elevation_bounds: [0., 5.]\n";
+    out << "  linear_tolerance: 0.01\n";
+    out << "  angular_tolerance: 0.5\n";
+    out << "  points:\n" << points_.str();
+    out << "  connections:\n" << connections_.str();
+    out << "  groups:\n";
+    for (const auto& name_connections : groups_) {
+      out << "    " << name_connections.first << ": [";
+      for (std::size_t i = 0; i < name_connections.second.size(); ++i) {
+        out << (i == 0 ? "" : ", ") << name_connections.second[i];
+      }
+      out << "]\n";
+    }
+    return out.str();
+  }
+
+ private:
+  // @returns Whether the intersection at @p column and @p row exists.
+  bool HasIntersection(int column, int row) const {
+    return column >= 0 && column < properties_.columns && row >= 0 && row < properties_.rows;
+  }
+
+  // @returns Whether there is a road leaving the intersection at @p column and @p row towards @p direction.
+  bool HasRoad(int column, int row, Direction direction) const {
+    const std::pair<int, int> offset = Offset(direction);
+    const bool allowed_direction =
+        properties_.two_way || direction == Direction::kEast || direction == Direction::kNorth;
+    return allowed_direction && HasIntersection(column, row) &&
+           HasIntersection(column + offset.first, row + offset.second);
+  }
+
+  // @returns The name of the intersection at @p column and @p row.
+  static std::string IntersectionName(int column, int row) {
+    return std::to_string(column) + "_" + std::to_string(row);
+  }
+
+  // @returns The pose of lane 0 where a connection heading towards @p direction is @p distance ahead of the center of
+  // the intersection at @p column and @p row.
+  Pose LanePose(int column, int row, Direction direction, double distance) const {
+    const double heading = Heading(direction) * kPi / 180.;
+    const double x =
+        column * properties_.block_length + distance * std::cos(heading) + lane_0_offset_ * std::sin(heading);
+    const double y =
+        row * properties_.block_length + distance * std::sin(heading) - lane_0_offset_ * std::cos(heading);
+    // Avoids printing tiny values, e.g. -1.2e-16, where zeros are meant.
+    const auto round = [](double value) { return std::round(value * 1e9) / 1e9; };
+    return {round(x), round(y), Heading(direction)};
+  }
+
+  // Adds a connection named @p name that starts at @p start and whose geometry is described by @p geometry.
+  void AddConnection(const std::string& name, const Pose& start, const std::string& geometry) {
+    points_ << "    " << name << ":\n";
+    points_ << "      xypoint: [" << start.x << ", " << start.y << ", " << start.heading << "]\n";
+    points_ << "      zpoint: [0., 0., 0., 0.]\n";
+    connections_ << "    " << name << ":\n";
+    connections_ << "      lanes: [" << properties_.num_lanes << ", 0, 0.]\n";
+    connections_ << "      start: [\"ref\", \"points." << name << ".forward\"]\n";
+    connections_ << "      " << geometry << "\n";
+    connections_ << "      z_end: [\"ref\", [0., 0., 0., 0.]]\n";
+  }
+
+  // Adds the roads leaving the intersection at @p column and @p row towards east and north, in both directions when
+  // roads are two-way.
+  void AddRoads(int column, int row) {
+    for (const Direction direction : {Direction::kEast, Direction::kNorth}) {
+      const std::pair<int, int> offset = Offset(direction);
+      if (!HasIntersection(column + offset.first, row + offset.second)) {
+        continue;
+      }
+      const std::string road_name =
+          "r" + IntersectionName(column, row) + "_" + IntersectionName(column + offset.first, row + offset.second);
+      std::vector<std::string>& group = groups_[road_name];
+      std::ostringstream geometry;
+      geometry << std::setprecision(12) << "length: " << properties_.block_length - 2. * inset_;
+      AddConnection(road_name + "_f", LanePose(column, row, direction, inset_), geometry.str());
+      group.push_back(road_name + "_f");
+      if (properties_.two_way) {
+        const Direction opposite = kDirections[(static_cast<int>(direction) + 2) % 4];
+        AddConnection(road_name + "_b", LanePose(column + offset.first, row + offset.second, opposite, inset_),
+                      geometry.str());
+        group.push_back(road_name + "_b");
+      }
+    }
+  }
+
+  // Adds the connections of the intersection at @p column and @p row, from every road arriving at it to every road
+  // leaving it but the one it arrives from.
+  void AddIntersection(int column, int row) {
+    const std::string intersection_name = "i" + IntersectionName(column, row);
+    std::vector<std::string> group;
+    for (const Direction from : kDirections) {
+      // Roads arriving from @p from head towards the opposite direction.
+      const Direction heading = kDirections[(static_cast<int>(from) + 2) % 4];
+      const std::pair<int, int> offset = Offset(from);
+      if (!HasRoad(column + offset.first, row + offset.second, heading)) {
+        continue;
+      }
+      for (const Direction to : kDirections) {
+        const int quarter_turns = QuarterTurns(heading, to);
+        if (to == from || !HasRoad(column, row, to) || (quarter_turns != 0 && !properties_.turns)) {
+          continue;
+        }
+        std::ostringstream geometry;
+        geometry << std::setprecision(12);
+        if (quarter_turns == 0) {
+          geometry << "length: " << 2. * inset_;
+        } else if (quarter_turns == 1) {
+          geometry << "arc: [" << inset_ + lane_0_offset_ << ", 90.]";
+        } else {
+          geometry << "arc: [" << inset_ - lane_0_offset_ << ", -90.]";
+        }
+        const std::string name = intersection_name + "_" + Letter(from) + Letter(to);
+        AddConnection(name, LanePose(column, row, heading, -inset_), geometry.str());
+        group.push_back(name);
+      }
+    }
+    if (!group.empty()) {
+      groups_[intersection_name] = group;
+    }
+  }
+
+  const SyntheticRoadNetworkProperties properties_;
+  const double lane_0_offset_{};
+  const double inset_{};
+  std::ostringstream points_;
+  std::ostringstream connections_;
+  std::map<std::string, std::vector<std::string>> groups_;
+};
+
+}  // namespace
+
+std::string GenerateSyntheticMultilaneYaml(const SyntheticRoadNetworkProperties& properties) {
+  return SyntheticYamlGenerator(properties).Generate();
+}
+
+std::unique_ptr<api::RoadNetwork> CreateSyntheticRoadNetwork(const SyntheticRoadNetworkProperties& properties) {
+  maliput::log()->debug("Building synthetic {}x{} multilane RoadNetwork.", properties.rows, properties.columns);
+  maliput::multilane::RoadNetworkConfiguration config;
+  config.yaml_description = GenerateSyntheticMultilaneYaml(properties);
+  return maliput::multilane::BuildRoadNetwork(config);
+}
+
+}  // namespace integration
+}  // namespace maliput
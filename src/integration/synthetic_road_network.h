@@ -0,0 +1,76 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <maliput/api/road_network.h>
+
+namespace maliput {
+namespace integration {
+
+/// Contains the attributes of a synthetic grid of roads, used to build city-scale road networks for stress tests.
+///
+/// Intersections are laid out in `rows` by `columns`, `block_length` apart, and adjacent ones are joined by straight
+/// roads. A single row yields a chain of roads. Each intersection is a junction holding a straight connection for every
+/// pair of opposite roads and, optionally, a turning connection for every pair of perpendicular ones. Every road is a
+/// junction too, with a segment per direction.
+struct SyntheticRoadNetworkProperties {
+  /// Number of rows of intersections. It must be positive.
+  int rows{10};
+  /// Number of columns of intersections. It must be positive, and the grid must hold more than one intersection.
+  int columns{10};
+  /// Number of lanes per direction. It must be positive.
+  int num_lanes{2};
+  /// Width of the lanes. It must be positive.
+  double lane_width{3.7};
+  /// Distance between the centers of adjacent intersections. It must be long enough to fit the intersections.
+  double block_length{100.};
+  /// Whether roads have lanes in both directions. Otherwise, they only run east and north.
+  bool two_way{true};
+  /// Whether intersections have turning connections. Otherwise, vehicles can only go straight.
+  bool turns{true};
+};
+
+/// Generates the maliput_multilane YAML description of the grid `properties` describe.
+/// @param properties The grid to describe.
+/// @returns The YAML description.
+/// @throw maliput::common::assertion_error When `properties` are not valid.
+std::string GenerateSyntheticMultilaneYaml(const SyntheticRoadNetworkProperties& properties);
+
+/// Builds, via maliput_multilane, the api::RoadNetwork of the grid `properties` describe.
+/// @param properties The grid to build.
+/// @returns The api::RoadNetwork.
+/// @throw maliput::common::assertion_error When `properties` are not valid.
+std::unique_ptr<api::RoadNetwork> CreateSyntheticRoadNetwork(const SyntheticRoadNetworkProperties& properties);
+
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,96 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Runs tasks on a fixed number of worker threads.
+///
+/// Tasks are run in submission order as workers become available. Exceptions thrown by a task are captured in the
+/// std::future returned by Submit(). On destruction, pending tasks are run before the workers are joined.
+///
+/// Submit() is thread safe.
+class ThreadPool {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool)
+  ThreadPool() = delete;
+
+  /// Constructs a ThreadPool.
+  /// @param num_threads Number of worker threads. When zero, the number of hardware threads is used.
+  /// @throw maliput::common::assertion_error When `num_threads` is negative.
+  explicit ThreadPool(int num_threads);
+
+  ~ThreadPool();
+
+  /// Queues `task` to be run by a worker.
+  /// @param task Callable with no arguments.
+  /// @returns A std::future that holds the result of `task`, or the exception it threw.
+  template <typename F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> Submit(F&& task) {
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+    auto packaged_task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+    std::future<Result> result = packaged_task->get_future();
+    Enqueue([packaged_task]() { (*packaged_task)(); });
+    return result;
+  }
+
+  /// @returns The number of worker threads.
+  int num_threads() const { return static_cast<int>(workers_.size()); }
+
+ private:
+  // Queues @p task and wakes up a worker.
+  void Enqueue(std::function<void()> task);
+
+  // Runs queued tasks until the pool is stopped and the queue is empty.
+  void WorkerLoop();
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::queue<std::function<void()>> tasks_;
+  bool stop_{false};
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace integration
+}  // namespace maliput
@@ -29,7 +29,16 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "integration/tools.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <maliput/base/intersection_book.h>
 #include <maliput/base/intersection_book_loader.h>
@@ -56,6 +65,9 @@
 #include <maliput_osm/builder/road_network_builder.h>
 #include <yaml-cpp/yaml.h>
 
+#include "integration/phase_profiler.h"
+#include "integration/thread_pool.h"
+
 namespace maliput {
 namespace integration {
 namespace {
@@ -80,14 +92,86 @@ const std::map<std::string, MaliputImplementation> string_to_maliput_impl{
     {"osm", MaliputImplementation::kOsm},
 };
 
-// @returns @p file_name 's path located at @p env path. If not located, an empty string is returned.
-// @throws maliput::common::assertion_error When @p file_name is an absolute path.
-std::string GetFilePathFromEnv(const std::string& file_name, const std::string& env) {
-  MALIPUT_THROW_UNLESS(!maliput::common::Path{file_name}.is_absolute());
-  maliput::common::Path file_path = maliput::common::Filesystem::get_env_path(env);
-  file_path.append(file_name);
-  // Returns empty string if file_path doesn't match any existing file.
-  return file_path.exists() ? file_path.get_path() : "";
+// Caches the paths GetResource() resolves resources to.
+class ResourceCache {
+ public:
+  // @returns The cached path of @p key, if any.
+  std::optional<std::string> Find(const std::string& key) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = paths_.find(key);
+    return it == paths_.end() ? std::nullopt : std::make_optional(it->second);
+  }
+
+  void Insert(const std::string& key, const std::string& path) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    paths_.emplace(key, path);
+  }
+
+  void Clear() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    paths_.clear();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::string> paths_;
+};
+
+ResourceCache& GetResourceCache() {
+  static ResourceCache resource_cache;
+  return resource_cache;
+}
+
+// @returns @p file_name 's path located at the first of the colon-separated @p search_roots that contains it. If not
+// located, an empty string is returned.
+std::string GetFilePathFromSearchRoots(const std::string& file_name, const std::string& search_roots) {
+  std::size_t begin{0};
+  while (begin <= search_roots.size()) {
+    const std::size_t end = std::min(search_roots.find(':', begin), search_roots.size());
+    const std::string search_root = search_roots.substr(begin, end - begin);
+    begin = end + 1;
+    if (search_root.empty()) {
+      continue;
+    }
+    maliput::common::Path file_path{search_root};
+    file_path.append(file_name);
+    if (file_path.exists()) {
+      return file_path.get_path();
+    }
+  }
+  return "";
+}
+
+// Adds the rule registry and book files of @p build_properties, resolved with @p get_resource, to
+// @p build_configuration under the keys the backends expect. Nothing is added when `build_properties.geometry_only`
+// is true. The loaded and skipped books are logged.
+// @tparam BuildProperties MalidriveBuildProperties or MaliputOsmBuildProperties.
+template <typename BuildProperties, typename GetResourceFunction>
+void AddBooks(const BuildProperties& build_properties, const GetResourceFunction& get_resource,
+              std::map<std::string, std::string>* build_configuration) {
+  const std::vector<std::pair<std::string, std::string>> books{
+      {"rule_registry", build_properties.rule_registry_file},
+      {"road_rule_book", build_properties.road_rule_book_file},
+      {"traffic_light_book", build_properties.traffic_light_book_file},
+      {"phase_ring_book", build_properties.phase_ring_book_file},
+      {"intersection_book", build_properties.intersection_book_file},
+  };
+  std::string loaded_books;
+  std::string skipped_books;
+  for (const auto& [key, file_name] : books) {
+    if (file_name.empty()) {
+      continue;
+    }
+    std::string* book_list = build_properties.geometry_only ? &skipped_books : &loaded_books;
+    book_list->append(book_list->empty() ? key : ", " + key);
+    if (!build_properties.geometry_only) {
+      build_configuration->emplace(key, get_resource(file_name));
+    }
+  }
+  maliput::log()->debug("Books to load: [{}].", loaded_books);
+  if (!skipped_books.empty()) {
+    maliput::log()->info("Geometry only build, skipping books: [{}].", skipped_books);
+  }
 }
 
 }  // namespace
@@ -101,14 +185,21 @@ MaliputImplementation StringToMaliputImplementation(const std::string& maliput_i
   return string_to_maliput_impl.at(maliput_impl);
 }
 
-std::unique_ptr<api::RoadNetwork> CreateDragwayRoadNetwork(const DragwayBuildProperties& build_properties) {
+std::unique_ptr<api::RoadNetwork> CreateDragwayRoadNetwork(const DragwayBuildProperties& build_properties,
+                                                           PhaseProfiler* profiler) {
   maliput::log()->debug("Building dragway RoadNetwork.");
-  auto rg = std::make_unique<dragway::RoadGeometry>(
-      api::RoadGeometryId{"Dragway with " + std::to_string(build_properties.num_lanes) + " lanes."},
-      build_properties.num_lanes, build_properties.length, build_properties.lane_width, build_properties.shoulder_width,
-      build_properties.maximum_height, std::numeric_limits<double>::epsilon(), std::numeric_limits<double>::epsilon(),
-      maliput::math::Vector3(0, 0, 0));
+  std::unique_ptr<dragway::RoadGeometry> rg;
+  {
+    const PhaseProfiler::ScopedPhase phase(profiler, "road_geometry");
+    rg = std::make_unique<dragway::RoadGeometry>(
+        api::RoadGeometryId{"Dragway with " + std::to_string(build_properties.num_lanes) + " lanes."},
+        build_properties.num_lanes, build_properties.length, build_properties.lane_width,
+        build_properties.shoulder_width, build_properties.maximum_height, std::numeric_limits<double>::epsilon(),
+        std::numeric_limits<double>::epsilon(), maliput::math::Vector3(0, 0, 0));
+  }
 
+  std::unique_ptr<PhaseProfiler::ScopedPhase> books_phase =
+      std::make_unique<PhaseProfiler::ScopedPhase>(profiler, "books");
   std::unique_ptr<ManualRulebook> rulebook = std::make_unique<ManualRulebook>();
   std::unique_ptr<TrafficLightBook> traffic_light_book = std::make_unique<TrafficLightBook>();
   std::unique_ptr<api::rules::RuleRegistry> rule_registry = std::make_unique<api::rules::RuleRegistry>();
@@ -125,6 +216,9 @@ std::unique_ptr<api::RoadNetwork> CreateDragwayRoadNetwork(const DragwayBuildPro
       std::make_unique<ManualDiscreteValueRuleStateProvider>(rulebook.get());
   std::unique_ptr<ManualRangeValueRuleStateProvider> range_value_rule_state_provider =
       std::make_unique<ManualRangeValueRuleStateProvider>(rulebook.get());
+  books_phase.reset();
+
+  const PhaseProfiler::ScopedPhase assembly_phase(profiler, "road_network_assembly");
   return std::make_unique<api::RoadNetwork>(std::move(rg), std::move(rulebook), std::move(traffic_light_book),
                                             std::move(intersection_book), std::move(phase_ring_book),
                                             std::move(right_of_way_rule_state_provider), std::move(phase_provider),
@@ -132,25 +226,33 @@ std::unique_ptr<api::RoadNetwork> CreateDragwayRoadNetwork(const DragwayBuildPro
                                             std::move(range_value_rule_state_provider));
 }
 
-std::unique_ptr<api::RoadNetwork> CreateMultilaneRoadNetwork(const MultilaneBuildProperties& build_properties) {
+std::unique_ptr<api::RoadNetwork> CreateMultilaneRoadNetwork(const MultilaneBuildProperties& build_properties,
+                                                             PhaseProfiler* profiler) {
   maliput::log()->debug("Building multilane RoadNetwork.");
   if (build_properties.yaml_file.empty()) {
     MALIPUT_ABORT_MESSAGE("yaml_file cannot be empty.");
   }
-  const std::string yaml_file_path = GetResource(MaliputImplementation::kMultilane, build_properties.yaml_file);
   maliput::multilane::RoadNetworkConfiguration config;
-  config.yaml_file = yaml_file_path;
+  {
+    const PhaseProfiler::ScopedPhase phase(profiler, "resource_resolution");
+    config.yaml_file = GetResource(MaliputImplementation::kMultilane, build_properties.yaml_file);
+  }
+  const PhaseProfiler::ScopedPhase phase(profiler, "backend_build");
   return maliput::multilane::BuildRoadNetwork(config);
 }
 
-std::unique_ptr<api::RoadNetwork> CreateMalidriveRoadNetwork(const MalidriveBuildProperties& build_properties) {
+std::unique_ptr<api::RoadNetwork> CreateMalidriveRoadNetwork(const MalidriveBuildProperties& build_properties,
+                                                             PhaseProfiler* profiler) {
   maliput::log()->debug("Building malidrive RoadNetwork.");
   MALIPUT_VALIDATE(!build_properties.xodr_file_path.empty(), "opendrive_file cannot be empty.");
+  const auto get_resource = [profiler](const std::string& resource_name) {
+    const PhaseProfiler::ScopedPhase phase(profiler, "resource_resolution");
+    return GetResource(MaliputImplementation::kMalidrive, resource_name);
+  };
 
   std::map<std::string, std::string> road_network_configuration;
   road_network_configuration.emplace("road_geometry_id", "malidrive_rg");
-  road_network_configuration.emplace("opendrive_file",
-                                     GetResource(MaliputImplementation::kMalidrive, build_properties.xodr_file_path));
+  road_network_configuration.emplace("opendrive_file", get_resource(build_properties.xodr_file_path));
   if (build_properties.linear_tolerance.has_value()) {
     road_network_configuration.emplace("linear_tolerance", std::to_string(build_properties.linear_tolerance.value()));
   }
@@ -169,62 +271,31 @@ std::unique_ptr<api::RoadNetwork> CreateMalidriveRoadNetwork(const MalidriveBuil
   road_network_configuration.emplace("standard_strictness_policy", build_properties.standard_strictness_policy);
   road_network_configuration.emplace("omit_nondrivable_lanes",
                                      build_properties.omit_nondrivable_lanes ? "true" : "false");
-  if (!build_properties.rule_registry_file.empty()) {
-    road_network_configuration.emplace(
-        "rule_registry", GetResource(MaliputImplementation::kMalidrive, build_properties.rule_registry_file));
-  }
-  if (!build_properties.road_rule_book_file.empty()) {
-    road_network_configuration.emplace(
-        "road_rule_book", GetResource(MaliputImplementation::kMalidrive, build_properties.road_rule_book_file));
-  }
-  if (!build_properties.traffic_light_book_file.empty()) {
-    road_network_configuration.emplace(
-        "traffic_light_book", GetResource(MaliputImplementation::kMalidrive, build_properties.traffic_light_book_file));
-  }
-  if (!build_properties.phase_ring_book_file.empty()) {
-    road_network_configuration.emplace(
-        "phase_ring_book", GetResource(MaliputImplementation::kMalidrive, build_properties.phase_ring_book_file));
-  }
-  if (!build_properties.intersection_book_file.empty()) {
-    road_network_configuration.emplace(
-        "intersection_book", GetResource(MaliputImplementation::kMalidrive, build_properties.intersection_book_file));
-  }
+  AddBooks(build_properties, get_resource, &road_network_configuration);
 
+  const PhaseProfiler::ScopedPhase phase(profiler, "backend_build");
   return malidrive::loader::Load<malidrive::builder::RoadNetworkBuilder>(road_network_configuration);
 }
 
-std::unique_ptr<api::RoadNetwork> CreateMaliputOsmRoadNetwork(const MaliputOsmBuildProperties& build_properties) {
+std::unique_ptr<api::RoadNetwork> CreateMaliputOsmRoadNetwork(const MaliputOsmBuildProperties& build_properties,
+                                                              PhaseProfiler* profiler) {
   maliput::log()->debug("Building maliput_osm RoadNetwork.");
   MALIPUT_VALIDATE(!build_properties.osm_file.empty(), "osm_file cannot be empty.");
+  const auto get_resource = [profiler](const std::string& resource_name) {
+    const PhaseProfiler::ScopedPhase phase(profiler, "resource_resolution");
+    return GetResource(MaliputImplementation::kOsm, resource_name);
+  };
 
   std::map<std::string, std::string> build_configuration;
   build_configuration.emplace("road_geometry_id", "maliput_osm_rg");
-  build_configuration.emplace("osm_file", GetResource(MaliputImplementation::kOsm, build_properties.osm_file));
+  build_configuration.emplace("osm_file", get_resource(build_properties.osm_file));
   build_configuration.emplace("linear_tolerance", std::to_string(build_properties.linear_tolerance));
   build_configuration.emplace("angular_tolerance", std::to_string(build_properties.angular_tolerance));
   build_configuration.emplace("inertial_to_backend_frame_translation", "{0., 0., 0.}");
   build_configuration.emplace("origin", build_properties.origin.to_str());
-  if (!build_properties.rule_registry_file.empty()) {
-    build_configuration.emplace("rule_registry",
-                                GetResource(MaliputImplementation::kOsm, build_properties.rule_registry_file));
-  }
-  if (!build_properties.road_rule_book_file.empty()) {
-    build_configuration.emplace("road_rule_book",
-                                GetResource(MaliputImplementation::kOsm, build_properties.road_rule_book_file));
-  }
-  if (!build_properties.traffic_light_book_file.empty()) {
-    build_configuration.emplace("traffic_light_book",
-                                GetResource(MaliputImplementation::kOsm, build_properties.traffic_light_book_file));
-  }
-  if (!build_properties.phase_ring_book_file.empty()) {
-    build_configuration.emplace("phase_ring_book",
-                                GetResource(MaliputImplementation::kOsm, build_properties.phase_ring_book_file));
-  }
-  if (!build_properties.intersection_book_file.empty()) {
-    build_configuration.emplace("intersection_book",
-                                GetResource(MaliputImplementation::kOsm, build_properties.intersection_book_file));
-  }
+  AddBooks(build_properties, get_resource, &build_configuration);
 
+  const PhaseProfiler::ScopedPhase phase(profiler, "backend_build");
   return maliput_osm::builder::RoadNetworkBuilder(build_configuration)();
 }
 
@@ -232,38 +303,101 @@ std::unique_ptr<api::RoadNetwork> LoadRoadNetwork(MaliputImplementation maliput_
                                                   const DragwayBuildProperties& dragway_build_properties,
                                                   const MultilaneBuildProperties& multilane_build_properties,
                                                   const MalidriveBuildProperties& malidrive_build_properties,
-                                                  const MaliputOsmBuildProperties& maliput_osm_build_properties) {
+                                                  const MaliputOsmBuildProperties& maliput_osm_build_properties,
+                                                  PhaseProfiler* profiler) {
+  const PhaseProfiler::ScopedPhase phase(profiler, "load_road_network");
   switch (maliput_implementation) {
     case MaliputImplementation::kDragway:
-      return CreateDragwayRoadNetwork(dragway_build_properties);
+      return CreateDragwayRoadNetwork(dragway_build_properties, profiler);
     case MaliputImplementation::kMultilane:
-      return CreateMultilaneRoadNetwork(multilane_build_properties);
+      return CreateMultilaneRoadNetwork(multilane_build_properties, profiler);
     case MaliputImplementation::kMalidrive:
-      return CreateMalidriveRoadNetwork(malidrive_build_properties);
+      return CreateMalidriveRoadNetwork(malidrive_build_properties, profiler);
     case MaliputImplementation::kOsm:
-      return CreateMaliputOsmRoadNetwork(maliput_osm_build_properties);
+      return CreateMaliputOsmRoadNetwork(maliput_osm_build_properties, profiler);
     default:
       MALIPUT_ABORT_MESSAGE("Error loading RoadNetwork. Unknown implementation.");
   }
 }
 
+std::vector<std::future<std::unique_ptr<api::RoadNetwork>>> LoadRoadNetworksAsync(
+    const std::vector<RoadNetworkDescriptor>& descriptors, ThreadPool* thread_pool) {
+  MALIPUT_THROW_UNLESS(thread_pool != nullptr);
+  std::vector<std::future<std::unique_ptr<api::RoadNetwork>>> road_networks;
+  road_networks.reserve(descriptors.size());
+  for (const RoadNetworkDescriptor& descriptor : descriptors) {
+    road_networks.push_back(thread_pool->Submit([descriptor]() {
+      return LoadRoadNetwork(descriptor.maliput_implementation, descriptor.dragway_build_properties,
+                             descriptor.multilane_build_properties, descriptor.malidrive_build_properties,
+                             descriptor.maliput_osm_build_properties);
+    }));
+  }
+  return road_networks;
+}
+
+std::vector<RoadNetworkLoadResult> LoadRoadNetworks(const std::vector<RoadNetworkDescriptor>& descriptors,
+                                                    int num_threads) {
+  MALIPUT_THROW_UNLESS(num_threads >= 0);
+  std::vector<RoadNetworkLoadResult> results(descriptors.size());
+  if (descriptors.empty()) {
+    return results;
+  }
+  if (num_threads == 0) {
+    num_threads = std::min(std::max(1, static_cast<int>(std::thread::hardware_concurrency())),
+                           static_cast<int>(descriptors.size()));
+  }
+  ThreadPool thread_pool(num_threads);
+  std::vector<std::future<std::unique_ptr<api::RoadNetwork>>> road_networks =
+      LoadRoadNetworksAsync(descriptors, &thread_pool);
+  for (std::size_t i = 0; i < road_networks.size(); ++i) {
+    try {
+      results[i].road_network = road_networks[i].get();
+    } catch (const std::exception& e) {
+      results[i].error = e.what();
+      maliput::log()->error("Error loading RoadNetwork {} of {}: {}", i + 1, descriptors.size(), results[i].error);
+    }
+  }
+  return results;
+}
+
 std::string GetResource(const MaliputImplementation& maliput_implementation, const std::string& resource_name) {
-  std::string file_path{""};
+  std::string file_name{""};
+  std::string env{""};
   switch (maliput_implementation) {
     case MaliputImplementation::kMalidrive:
-      file_path = GetFilePathFromEnv("resources/odr/" + resource_name, MALIPUT_MALIDRIVE_RESOURCE_ROOT);
+      file_name = "resources/odr/" + resource_name;
+      env = MALIPUT_MALIDRIVE_RESOURCE_ROOT;
       break;
     case MaliputImplementation::kMultilane:
-      file_path = GetFilePathFromEnv(resource_name, MULTILANE_RESOURCE_ROOT);
+      file_name = resource_name;
+      env = MULTILANE_RESOURCE_ROOT;
       break;
     case MaliputImplementation::kOsm:
-      file_path = GetFilePathFromEnv("resources/osm/" + resource_name, MALIPUT_OSM_RESOURCE_ROOT);
+      file_name = "resources/osm/" + resource_name;
+      env = MALIPUT_OSM_RESOURCE_ROOT;
       break;
     default:
-      break;
+      return resource_name;
+  }
+  if (resource_name.empty() || maliput::common::Path{resource_name}.is_absolute()) {
+    return resource_name;
   }
-  return file_path.empty() ? resource_name : file_path;
+
+  // The search roots are part of the key, so changing the environment variable doesn't hit stale entries.
+  const char* search_roots_env = std::getenv(env.c_str());
+  const std::string search_roots{search_roots_env != nullptr ? search_roots_env : ""};
+  const std::string key = env + "=" + search_roots + "\n" + file_name;
+  ResourceCache& resource_cache = GetResourceCache();
+  if (const std::optional<std::string> cached_path = resource_cache.Find(key); cached_path.has_value()) {
+    return cached_path.value();
+  }
+  const std::string file_path = GetFilePathFromSearchRoots(file_name, search_roots);
+  const std::string resolved_path = file_path.empty() ? resource_name : file_path;
+  resource_cache.Insert(key, resolved_path);
+  return resolved_path;
 }
 
+void ClearResourceCache() { GetResourceCache().Clear(); }
+
 }  // namespace integration
 }  // namespace maliput
@@ -29,9 +29,11 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <maliput/api/road_geometry.h>
 #include <maliput/api/road_network.h>
@@ -39,6 +41,9 @@
 namespace maliput {
 namespace integration {
 
+class PhaseProfiler;
+class ThreadPool;
+
 /// Available maliput implementations.
 enum class MaliputImplementation {
   kMalidrive,  //< malidrive implementation.
@@ -87,6 +92,9 @@ struct MalidriveBuildProperties {
   std::string traffic_light_book_file{""};
   std::string phase_ring_book_file{""};
   std::string intersection_book_file{""};
+  /// When true, the rule registry and the books above are not loaded, so workflows that only need the
+  /// api::RoadGeometry don't pay for parsing and indexing them.
+  bool geometry_only{false};
 };
 
 /// Contains the attributes needed for building a maliput_osm RoadNetwork.
@@ -100,33 +108,50 @@ struct MaliputOsmBuildProperties {
   std::string traffic_light_book_file{""};
   std::string phase_ring_book_file{""};
   std::string intersection_book_file{""};
+  /// When true, the rule registry and the books above are not loaded, so workflows that only need the
+  /// api::RoadGeometry don't pay for parsing and indexing them.
+  bool geometry_only{false};
 };
 
 /// Builds an api::RoadNetwork based on Dragway implementation.
 /// @param build_properties Holds the properties to build the RoadNetwork.
+/// @param profiler Optional PhaseProfiler to record the building phases into: `road_geometry`, `books` and
+///                 `road_network_assembly`. It could be nullptr.
 /// @return A maliput::api::RoadNetwork.
-std::unique_ptr<api::RoadNetwork> CreateDragwayRoadNetwork(const DragwayBuildProperties& build_properties);
+std::unique_ptr<api::RoadNetwork> CreateDragwayRoadNetwork(const DragwayBuildProperties& build_properties,
+                                                           PhaseProfiler* profiler = nullptr);
 
 /// Builds an api::RoadNetwork based on Multilane implementation.
 /// @param build_properties Holds the properties to build the RoadNetwork.
+/// @param profiler Optional PhaseProfiler to record the building phases into: `resource_resolution` and
+///                 `backend_build`. It could be nullptr.
 /// @return A maliput::api::RoadNetwork.
 ///
 /// @throw maliput::common::assertion_error When `build_properties.yaml_file` is empty.
-std::unique_ptr<api::RoadNetwork> CreateMultilaneRoadNetwork(const MultilaneBuildProperties& build_properties);
+std::unique_ptr<api::RoadNetwork> CreateMultilaneRoadNetwork(const MultilaneBuildProperties& build_properties,
+                                                             PhaseProfiler* profiler = nullptr);
 
 /// Builds an api::RoadNetwork based on Malidrive implementation.
 /// @param build_properties Holds the properties to build the RoadNetwork.
+/// @param profiler Optional PhaseProfiler to record the building phases into: `resource_resolution` and
+///                 `backend_build`. The latter covers XODR parsing, geometry building and the loading of the YAML
+///                 books, which the backend performs as a single step. It could be nullptr.
 /// @return A maliput::api::RoadNetwork.
 ///
 /// @throw maliput::common::assertion_error When `build_properties.xodr_file_path` is empty.
-std::unique_ptr<api::RoadNetwork> CreateMalidriveRoadNetwork(const MalidriveBuildProperties& build_properties);
+std::unique_ptr<api::RoadNetwork> CreateMalidriveRoadNetwork(const MalidriveBuildProperties& build_properties,
+                                                             PhaseProfiler* profiler = nullptr);
 
 /// Builds an api::RoadNetwork based on MaliputOsm implementation.
 /// @param build_properties Holds the properties to build the RoadNetwork.
+/// @param profiler Optional PhaseProfiler to record the building phases into: `resource_resolution` and
+///                 `backend_build`. The latter covers OSM parsing, geometry building and the loading of the YAML
+///                 books, which the backend performs as a single step. It could be nullptr.
 /// @return A maliput::api::RoadNetwork.
 ///
 /// @throw maliput::common::assertion_error When `build_properties.osm_file` is empty.
-std::unique_ptr<api::RoadNetwork> CreateMaliputOsmRoadNetwork(const MaliputOsmBuildProperties& build_properties);
+std::unique_ptr<api::RoadNetwork> CreateMaliputOsmRoadNetwork(const MaliputOsmBuildProperties& build_properties,
+                                                              PhaseProfiler* profiler = nullptr);
 
 /// Builds an api::RoadNetwork using the implementation that `maliput_implementation` describes.
 /// @param maliput_implementation One of MaliputImplementation. (kDragway, kMultilane, kMalidrive).
@@ -134,6 +159,8 @@ std::unique_ptr<api::RoadNetwork> CreateMaliputOsmRoadNetwork(const MaliputOsmBu
 /// @param multilane_build_properties Holds the properties to build a multilane RoadNetwork.
 /// @param malidrive_build_properties Holds the properties to build a malidrive RoadNetwork.
 /// @param maliput_osm_build_properties Holds the properties to build a maliput_osm RoadNetwork.
+/// @param profiler Optional PhaseProfiler to record the building phases into. They are nested within a
+///                 `load_road_network` phase. It could be nullptr.
 /// @return A maliput::api::RoadNetwork.
 ///
 /// @throw maliput::common::assertion_error When `maliput_implementation` is unknown.
@@ -141,11 +168,60 @@ std::unique_ptr<api::RoadNetwork> LoadRoadNetwork(MaliputImplementation maliput_
                                                   const DragwayBuildProperties& dragway_build_properties,
                                                   const MultilaneBuildProperties& multilane_build_properties,
                                                   const MalidriveBuildProperties& malidrive_build_properties,
-                                                  const MaliputOsmBuildProperties& maliput_osm_build_properties);
+                                                  const MaliputOsmBuildProperties& maliput_osm_build_properties,
+                                                  PhaseProfiler* profiler = nullptr);
+
+/// Describes an api::RoadNetwork to be built by LoadRoadNetwork().
+/// Only the build properties that match `maliput_implementation` are used.
+struct RoadNetworkDescriptor {
+  MaliputImplementation maliput_implementation{MaliputImplementation::kDragway};
+  DragwayBuildProperties dragway_build_properties{};
+  MultilaneBuildProperties multilane_build_properties{};
+  MalidriveBuildProperties malidrive_build_properties{};
+  MaliputOsmBuildProperties maliput_osm_build_properties{};
+};
+
+/// Outcome of building a RoadNetworkDescriptor with LoadRoadNetworks().
+struct RoadNetworkLoadResult {
+  /// The built api::RoadNetwork. It is nullptr when the build failed.
+  std::unique_ptr<api::RoadNetwork> road_network;
+  /// Description of the error when the build failed. It is empty otherwise.
+  std::string error;
+};
+
+/// Queues the build of each descriptor in `descriptors` on `thread_pool`, so independent maps are built concurrently.
+/// @param descriptors Describe the api::RoadNetworks to build. They are copied, so they don't need to outlive the
+///                    builds.
+/// @param thread_pool ThreadPool to build the api::RoadNetworks on. It must not be nullptr.
+/// @return One std::future per descriptor, in the same order. A failed build rethrows its exception on
+///         std::future::get().
+///
+/// @throw maliput::common::assertion_error When `thread_pool` is nullptr.
+std::vector<std::future<std::unique_ptr<api::RoadNetwork>>> LoadRoadNetworksAsync(
+    const std::vector<RoadNetworkDescriptor>& descriptors, ThreadPool* thread_pool);
+
+/// Builds the api::RoadNetworks described by `descriptors` concurrently and waits for all of them.
+/// The wall time approaches the one of the slowest build as long as there are enough threads.
+/// @param descriptors Describe the api::RoadNetworks to build.
+/// @param num_threads Maximum number of builds to run at the same time. When zero, the minimum of the number of
+///                    hardware threads and the number of descriptors is used.
+/// @return One RoadNetworkLoadResult per descriptor, in the same order. Failed builds are reported in their result
+///         and don't affect the others.
+///
+/// @throw maliput::common::assertion_error When `num_threads` is negative.
+std::vector<RoadNetworkLoadResult> LoadRoadNetworks(const std::vector<RoadNetworkDescriptor>& descriptors,
+                                                    int num_threads = 0);
 
 /// Obtains the correspondent path to the @p resource_name located at the maliput's implementation's resource directory
 /// if exists, otherwise it returns @p resource_name .
 ///
+/// The resource directory is read from the implementation's environment variable, which may hold several
+/// colon-separated search roots that are looked up in order. Resolved paths, including the resources that are not
+/// found, are cached per environment variable value, so repeated calls don't touch the filesystem. Use
+/// ClearResourceCache() when files are added or removed from the search roots.
+///
+/// This function is thread safe.
+///
 /// @param maliput_implementation One of MaliputImplementation. (kDragway, kMultilane, kMalidrive).
 /// @param resource_name Name of the resource.
 /// @returns
@@ -155,5 +231,8 @@ std::unique_ptr<api::RoadNetwork> LoadRoadNetwork(MaliputImplementation maliput_
 ///  - @p resource_name when @p resource_name is relative path but it isn't found at the malidrive resource folder.
 std::string GetResource(const MaliputImplementation& maliput_implementation, const std::string& resource_name);
 
+/// Clears the cache of the paths resolved by GetResource().
+void ClearResourceCache();
+
 }  // namespace integration
 }  // namespace maliput
@@ -0,0 +1,104 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/trajectory_localizer.h"
+
+#include <algorithm>
+
+#include <maliput/api/branch_point.h>
+#include <maliput/common/maliput_throw.h>
+
+namespace maliput {
+namespace integration {
+
+TrajectoryLocalizer::TrajectoryLocalizer(const api::RoadGeometry* road_geometry, double distance_threshold)
+    : road_geometry_(road_geometry), distance_threshold_(distance_threshold) {
+  MALIPUT_THROW_UNLESS(road_geometry_ != nullptr);
+  MALIPUT_THROW_UNLESS(distance_threshold_ >= 0.);
+}
+
+api::RoadPositionResult TrajectoryLocalizer::Localize(const api::InertialPosition& inertial_position) {
+  if (previous_lane_ != nullptr) {
+    UpdateCandidates(previous_lane_);
+    const api::Lane* best_lane{nullptr};
+    api::LanePositionResult best_result;
+    for (const api::Lane* lane : candidates_) {
+      const api::LanePositionResult result = lane->ToLanePosition(inertial_position);
+      if (best_lane == nullptr || result.distance < best_result.distance) {
+        best_lane = lane;
+        best_result = result;
+      }
+      // The sample is on this lane; no other candidate can be closer.
+      if (best_result.distance == 0.) {
+        break;
+      }
+    }
+    if (best_result.distance <= distance_threshold_) {
+      ++num_hint_hits_;
+      previous_lane_ = best_lane;
+      return {api::RoadPosition(best_lane, best_result.lane_position), best_result.nearest_position,
+              best_result.distance};
+    }
+  }
+  ++num_fallbacks_;
+  const api::RoadPositionResult result = road_geometry_->ToRoadPosition(inertial_position);
+  previous_lane_ = result.road_position.lane;
+  return result;
+}
+
+void TrajectoryLocalizer::UpdateCandidates(const api::Lane* lane) {
+  if (lane == candidates_lane_) {
+    return;
+  }
+  candidates_lane_ = lane;
+  candidates_.clear();
+  // The previous lane goes first as it is the most likely one.
+  AddCandidate(lane);
+  for (const api::LaneEnd::Which end : {api::LaneEnd::kFinish, api::LaneEnd::kStart}) {
+    for (const api::LaneEndSet* lane_end_set : {lane->GetOngoingBranches(end), lane->GetConfluentBranches(end)}) {
+      if (lane_end_set == nullptr) {
+        continue;
+      }
+      for (int i = 0; i < lane_end_set->size(); ++i) {
+        AddCandidate(lane_end_set->get(i).lane);
+      }
+    }
+  }
+  AddCandidate(lane->to_left());
+  AddCandidate(lane->to_right());
+}
+
+void TrajectoryLocalizer::AddCandidate(const api::Lane* lane) {
+  if (lane != nullptr && std::find(candidates_.begin(), candidates_.end(), lane) == candidates_.end()) {
+    candidates_.push_back(lane);
+  }
+}
+
+}  // namespace integration
+}  // namespace maliput
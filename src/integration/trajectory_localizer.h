@@ -0,0 +1,98 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <vector>
+
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/common/maliput_copyable.h>
+
+namespace maliput {
+namespace integration {
+
+/// Localizes consecutive samples of a trajectory on an api::RoadGeometry.
+///
+/// Consecutive samples almost always fall on the lane of the previous sample or on one of its neighbors, so each
+/// sample is first projected with api::Lane::ToLanePosition() onto that lane, the lanes ongoing and confluent at both
+/// of its ends and its adjacent lanes in the segment. The candidate closest to the sample is taken when it is within
+/// the distance threshold; otherwise, and for the first sample, the global api::RoadGeometry::ToRoadPosition() is
+/// used.
+///
+/// Where lanes overlap (e.g. in intersections) the hinted lane is preferred over the lane the global query would pick,
+/// which keeps the localization continuous along the trajectory.
+class TrajectoryLocalizer {
+ public:
+  MALIPUT_NO_COPY_NO_MOVE_NO_ASSIGN(TrajectoryLocalizer)
+  TrajectoryLocalizer() = delete;
+
+  /// Constructs a TrajectoryLocalizer.
+  /// @param road_geometry The road geometry to localize on. It must not be nullptr.
+  /// @param distance_threshold Maximum distance between a sample and its projection onto a hinted lane for the
+  ///        projection to be taken. It must be non negative.
+  /// @throw maliput::common::assertion_error When `road_geometry` is nullptr or `distance_threshold` is negative.
+  TrajectoryLocalizer(const api::RoadGeometry* road_geometry, double distance_threshold);
+
+  /// Localizes the next sample of the trajectory.
+  /// @param inertial_position The sample.
+  /// @returns The result of projecting `inertial_position` onto the road geometry.
+  api::RoadPositionResult Localize(const api::InertialPosition& inertial_position);
+
+  /// Forgets the previous sample, so the next one is localized with the global query. Use it when starting a new
+  /// trajectory.
+  void Reset() { previous_lane_ = nullptr; }
+
+  /// @returns The number of samples localized via the hinted lanes.
+  int num_hint_hits() const { return num_hint_hits_; }
+
+  /// @returns The number of samples localized via the global query.
+  int num_fallbacks() const { return num_fallbacks_; }
+
+ private:
+  // Fills candidates_ with the lanes to try for the sample following one on @p lane.
+  void UpdateCandidates(const api::Lane* lane);
+
+  // Appends @p lane to candidates_ unless it is nullptr or already there.
+  void AddCandidate(const api::Lane* lane);
+
+  const api::RoadGeometry* road_geometry_{};
+  const double distance_threshold_{};
+  const api::Lane* previous_lane_{nullptr};
+  // Lanes to try before falling back to the global query. They are kept while the previous lane doesn't change, and the
+  // storage is reused so no allocation happens per sample.
+  const api::Lane* candidates_lane_{nullptr};
+  std::vector<const api::Lane*> candidates_;
+  int num_hint_hits_{0};
+  int num_fallbacks_{0};
+};
+
+}  // namespace integration
+}  // namespace maliput
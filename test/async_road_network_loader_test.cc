@@ -0,0 +1,110 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/async_road_network_loader.h"
+
+#include <atomic>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using Status = AsyncRoadNetworkLoader::Status;
+
+GTEST_TEST(AsyncRoadNetworkLoaderTest, Ready) {
+  std::atomic<int> callback_calls{0};
+  std::atomic<Status> callback_status{Status::kPending};
+  AsyncRoadNetworkLoader dut(RoadNetworkDescriptor{}, [&callback_calls, &callback_status](Status status) {
+    callback_status = status;
+    ++callback_calls;
+  });
+  std::unique_ptr<api::RoadNetwork> road_network = dut.Get();
+  ASSERT_NE(nullptr, road_network);
+  EXPECT_NE(nullptr, road_network->road_geometry());
+  EXPECT_EQ(Status::kReady, dut.status());
+  EXPECT_TRUE(dut.WaitFor(0.));
+  EXPECT_GT(dut.elapsed(), 0.);
+  EXPECT_TRUE(dut.error().empty());
+  // Once done, it can't be cancelled.
+  EXPECT_FALSE(dut.Cancel());
+  EXPECT_EQ(Status::kReady, dut.status());
+  // The RoadNetwork can be taken only once.
+  EXPECT_THROW(dut.Get(), maliput::common::assertion_error);
+  // The callback runs after the waiters are notified.
+  while (callback_calls.load() == 0) {
+  }
+  EXPECT_EQ(1, callback_calls.load());
+  EXPECT_EQ(Status::kReady, callback_status.load());
+}
+
+GTEST_TEST(AsyncRoadNetworkLoaderTest, Failed) {
+  RoadNetworkDescriptor descriptor;
+  // An empty yaml file path makes the multilane build fail.
+  descriptor.maliput_implementation = MaliputImplementation::kMultilane;
+  AsyncRoadNetworkLoader dut(descriptor);
+  dut.Wait();
+  EXPECT_EQ(Status::kFailed, dut.status());
+  EXPECT_FALSE(dut.error().empty());
+  EXPECT_THROW(dut.Get(), maliput::common::assertion_error);
+}
+
+GTEST_TEST(AsyncRoadNetworkLoaderTest, Cancel) {
+  AsyncRoadNetworkLoader dut(RoadNetworkDescriptor{});
+  const bool cancelled = dut.Cancel();
+  dut.Wait();
+  if (cancelled) {
+    EXPECT_EQ(Status::kCancelled, dut.status());
+    EXPECT_THROW(dut.Get(), maliput::common::assertion_error);
+  } else {
+    // The load finished before Cancel() was called.
+    EXPECT_EQ(Status::kReady, dut.status());
+  }
+}
+
+GTEST_TEST(AsyncRoadNetworkLoaderTest, DestructorWaitsForTheLoad) {
+  std::atomic<bool> done{false};
+  { AsyncRoadNetworkLoader dut(RoadNetworkDescriptor{}, [&done](Status) { done = true; }); }
+  EXPECT_TRUE(done.load());
+}
+
+GTEST_TEST(AsyncRoadNetworkLoaderTest, StatusToString) {
+  EXPECT_EQ("pending", AsyncRoadNetworkLoaderStatusToString(Status::kPending));
+  EXPECT_EQ("loading", AsyncRoadNetworkLoaderStatusToString(Status::kLoading));
+  EXPECT_EQ("ready", AsyncRoadNetworkLoaderStatusToString(Status::kReady));
+  EXPECT_EQ("failed", AsyncRoadNetworkLoaderStatusToString(Status::kFailed));
+  EXPECT_EQ("cancelled", AsyncRoadNetworkLoaderStatusToString(Status::kCancelled));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,112 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/json_serialization.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// @returns The JSON representation of @p value.
+template <typename T>
+std::string ToJson(const T& value) {
+  std::ostringstream ss;
+  JsonWriter writer(&ss);
+  WriteJson(value, &writer);
+  return ss.str();
+}
+
+GTEST_TEST(JsonSerializationTest, Positions) {
+  EXPECT_EQ(R"({"x":1,"y":-2.5,"z":0})", ToJson(api::InertialPosition(1., -2.5, 0.)));
+  EXPECT_EQ(R"({"s":10,"r":0.5,"h":1})", ToJson(api::LanePosition(10., 0.5, 1.)));
+  EXPECT_EQ(R"({"lane_id":null,"lane_position":{"s":1,"r":2,"h":3}})",
+            ToJson(api::RoadPosition(nullptr, api::LanePosition(1., 2., 3.))));
+  EXPECT_EQ(R"({"min":-1.5,"max":2})", ToJson(api::RBounds(-1.5, 2.)));
+  EXPECT_THROW(WriteJson(api::LanePosition(), nullptr), common::assertion_error);
+}
+
+GTEST_TEST(JsonSerializationTest, Ranges) {
+  const api::LaneSRange first(api::LaneId("a"), api::SRange(0., 5.));
+  const api::LaneSRange second(api::LaneId("b"), api::SRange(5., 2.));
+  EXPECT_EQ(R"({"s0":5,"s1":2})", ToJson(second.s_range()));
+  EXPECT_EQ(R"({"lane_id":"a","s_range":{"s0":0,"s1":5}})", ToJson(first));
+  EXPECT_EQ(R"([{"lane_id":"a","s_range":{"s0":0,"s1":5}},{"lane_id":"b","s_range":{"s0":5,"s1":2}}])",
+            ToJson(api::LaneSRoute({first, second})));
+}
+
+GTEST_TEST(JsonSerializationTest, RuleStates) {
+  api::rules::DiscreteValueRule::DiscreteValue discrete_value;
+  discrete_value.severity = 1;
+  discrete_value.related_rules = {{"Yield", {api::rules::Rule::Id("a"), api::rules::Rule::Id("b")}}};
+  discrete_value.value = "Go";
+  EXPECT_EQ(R"({"severity":1,"related_rules":{"Yield":["a","b"]},"value":"Go"})", ToJson(discrete_value));
+
+  api::rules::RangeValueRule::Range range;
+  range.severity = 0;
+  range.description = "Speed limit";
+  range.min = 0.;
+  range.max = 16.5;
+  EXPECT_EQ(R"({"severity":0,"related_rules":{},"description":"Speed limit","min":0,"max":16.5})", ToJson(range));
+}
+
+GTEST_TEST(JsonSerializationTest, LaneResults) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateDragwayRoadNetwork(DragwayBuildProperties{1, 100., 3.7, 0., 5.});
+  const api::Lane* lane = road_network->road_geometry()->junction(0)->segment(0)->lane(0);
+  const std::string lane_id = lane->id().string();
+
+  EXPECT_EQ(R"({"lane_id":")" + lane_id + R"(","end":"finish"})",
+            ToJson(api::LaneEnd(lane, api::LaneEnd::kFinish)));
+
+  api::RoadPositionResult result;
+  result.road_position = api::RoadPosition(lane, api::LanePosition(2., 0., 0.));
+  result.nearest_position = api::InertialPosition(2., 0., 0.);
+  result.distance = 0.25;
+  EXPECT_EQ(R"({"road_position":{"lane_id":")" + lane_id +
+                R"(","lane_position":{"s":2,"r":0,"h":0}},"nearest_position":{"x":2,"y":0,"z":0},"distance":0.25})",
+            ToJson(result));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
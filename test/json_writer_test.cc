@@ -0,0 +1,100 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/json_writer.h"
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(JsonWriterTest, Constructor) { EXPECT_THROW(JsonWriter(nullptr), maliput::common::assertion_error); }
+
+GTEST_TEST(JsonWriterTest, Object) {
+  std::stringstream ss;
+  JsonWriter dut(&ss);
+  dut.StartObject()
+      .Key("string")
+      .Value("value")
+      .Key("int")
+      .Value(-3)
+      .Key("unsigned")
+      .Value(std::uint64_t{7})
+      .Key("double")
+      .Value(0.5)
+      .Key("bool")
+      .Value(true)
+      .Key("null")
+      .Null()
+      .EndObject();
+  EXPECT_EQ(R"({"string":"value","int":-3,"unsigned":7,"double":0.5,"bool":true,"null":null})", ss.str());
+}
+
+GTEST_TEST(JsonWriterTest, NestedContainers) {
+  std::stringstream ss;
+  JsonWriter dut(&ss);
+  dut.StartObject().Key("empty").StartArray().EndArray().Key("values").StartArray();
+  dut.Value(1).StartObject().Key("a").StartArray().Value(2).Value(3).EndArray().EndObject().Value(4);
+  dut.EndArray().Key("object").StartObject().EndObject().EndObject();
+  EXPECT_EQ(R"({"empty":[],"values":[1,{"a":[2,3]},4],"object":{}})", ss.str());
+}
+
+GTEST_TEST(JsonWriterTest, EscapesStrings) {
+  std::stringstream ss;
+  JsonWriter dut(&ss);
+  dut.Value("quote\" backslash\\ newline\n tab\t control\x01");
+  EXPECT_EQ(R"("quote\" backslash\\ newline\n tab\t control\u0001")", ss.str());
+}
+
+GTEST_TEST(JsonWriterTest, NonFiniteNumbersAreNull) {
+  std::stringstream ss;
+  JsonWriter dut(&ss);
+  dut.StartArray()
+      .Value(std::numeric_limits<double>::infinity())
+      .Value(std::numeric_limits<double>::quiet_NaN())
+      .EndArray();
+  EXPECT_EQ("[null,null]", ss.str());
+}
+
+GTEST_TEST(JsonWriterTest, Throws) {
+  std::stringstream ss;
+  JsonWriter dut(&ss);
+  EXPECT_THROW(dut.EndObject(), maliput::common::assertion_error);
+  EXPECT_THROW(dut.EndArray(), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,210 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_graph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/routing/derive_lane_s_routes.h>
+
+#include "integration/synthetic_road_network.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::LaneId;
+using api::LaneSRoute;
+
+constexpr double kTolerance{1e-9};
+
+void ExpectSameRoutes(const std::vector<LaneSRoute>& expected, const std::vector<LaneSRoute>& routes) {
+  ASSERT_EQ(expected.size(), routes.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].ranges().size(), routes[i].ranges().size());
+    for (std::size_t j = 0; j < expected[i].ranges().size(); ++j) {
+      EXPECT_EQ(expected[i].ranges()[j].lane_id(), routes[i].ranges()[j].lane_id());
+      EXPECT_NEAR(expected[i].ranges()[j].s_range().s0(), routes[i].ranges()[j].s_range().s0(), kTolerance);
+      EXPECT_NEAR(expected[i].ranges()[j].s_range().s1(), routes[i].ranges()[j].s_range().s1(), kTolerance);
+    }
+  }
+}
+
+GTEST_TEST(LaneGraphTest, Dragway) {
+  EXPECT_THROW(LaneGraph(nullptr), common::assertion_error);
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateDragwayRoadNetwork(DragwayBuildProperties{3, 100., 3.7, 0., 5.});
+  const LaneGraph dut(road_network->road_geometry());
+  EXPECT_EQ(3, dut.num_lanes());
+  // Dragway lanes are not connected to each other.
+  EXPECT_EQ(0, dut.num_edges());
+  for (int i = 0; i < dut.num_lanes(); ++i) {
+    EXPECT_EQ(i, dut.GetLaneIndex(dut.lane(i)));
+  }
+  EXPECT_THROW(dut.GetLaneIndex(nullptr), common::assertion_error);
+
+  const api::RoadPosition start(dut.lane(0), api::LanePosition(10., 0., 0.));
+  const api::RoadPosition end(dut.lane(0), api::LanePosition(60., 0., 0.));
+  const std::vector<LaneSRoute> routes = dut.DeriveLaneSRoutes(start, end, 0.);
+  ASSERT_EQ(1u, routes.size());
+  ASSERT_EQ(1u, routes[0].ranges().size());
+  EXPECT_EQ(dut.lane(0)->id(), routes[0].ranges()[0].lane_id());
+  EXPECT_NEAR(10., routes[0].ranges()[0].s_range().s0(), kTolerance);
+  EXPECT_NEAR(60., routes[0].ranges()[0].s_range().s1(), kTolerance);
+  EXPECT_TRUE(dut.DeriveLaneSRoutes(start, api::RoadPosition(dut.lane(1), end.pos), 1000.).empty());
+  EXPECT_THROW(dut.DeriveLaneSRoutes(api::RoadPosition(nullptr, start.pos), end, 1000.), common::assertion_error);
+}
+
+GTEST_TEST(LaneGraphTest, Chain) {
+  // A chain of three intersections, joined by one-way single lane roads along the x axis.
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{1, 3, 1, 3.7, 100., false, false});
+  const api::RoadGeometry* road_geometry = road_network->road_geometry();
+  const LaneGraph dut(road_geometry);
+  const api::Lane* first = road_geometry->ById().GetLane(LaneId("l:r0_0_1_0_f_0"));
+  const api::Lane* intersection = road_geometry->ById().GetLane(LaneId("l:i1_0_we_0"));
+  const api::Lane* last = road_geometry->ById().GetLane(LaneId("l:r1_0_2_0_f_0"));
+  ASSERT_NE(nullptr, first);
+  ASSERT_NE(nullptr, intersection);
+  ASSERT_NE(nullptr, last);
+
+  const std::vector<std::vector<const api::Lane*>> sequences = dut.FindLaneSequences(first, last, 1000.);
+  ASSERT_EQ(1u, sequences.size());
+  EXPECT_EQ((std::vector<const api::Lane*>{first, intersection, last}), sequences[0]);
+  // Only the intermediate lanes count towards the maximum length.
+  EXPECT_EQ(1u, dut.FindLaneSequences(first, last, intersection->length()).size());
+  EXPECT_TRUE(dut.FindLaneSequences(first, last, 0.5 * intersection->length()).empty());
+  EXPECT_EQ(1u, dut.FindLaneSequences(first, intersection, 0.).size());
+
+  const std::vector<LaneSRoute> routes = dut.DeriveLaneSRoutes(api::RoadPosition(first, api::LanePosition(20., 0., 0.)),
+                                                               api::RoadPosition(last, api::LanePosition(5., 0., 0.)),
+                                                               1000.);
+  ASSERT_EQ(1u, routes.size());
+  ASSERT_EQ(3u, routes[0].ranges().size());
+  EXPECT_NEAR(20., routes[0].ranges()[0].s_range().s0(), kTolerance);
+  EXPECT_NEAR(first->length(), routes[0].ranges()[0].s_range().s1(), kTolerance);
+  EXPECT_NEAR(0., routes[0].ranges()[1].s_range().s0(), kTolerance);
+  EXPECT_NEAR(intersection->length(), routes[0].ranges()[1].s_range().s1(), kTolerance);
+  EXPECT_NEAR(0., routes[0].ranges()[2].s_range().s0(), kTolerance);
+  EXPECT_NEAR(5., routes[0].ranges()[2].s_range().s1(), kTolerance);
+}
+
+// The routes on the graph must match maliput::routing::DeriveLaneSRoutes() ones, order included.
+GTEST_TEST(LaneGraphTest, MatchesDeriveLaneSRoutes) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{2, 2, 1, 3.7, 60., true, true});
+  const LaneGraph dut(road_network->road_geometry());
+  ASSERT_GT(dut.num_edges(), 0);
+  for (int i = 0; i < dut.num_lanes(); ++i) {
+    const api::RoadPosition start(dut.lane(i), api::LanePosition(0.25 * dut.lane(i)->length(), 0., 0.));
+    for (int j = 0; j < dut.num_lanes(); ++j) {
+      const api::RoadPosition end(dut.lane(j), api::LanePosition(0.75 * dut.lane(j)->length(), 0., 0.));
+      for (const double max_length : {0., 50., 150.}) {
+        SCOPED_TRACE(dut.lane(i)->id().string() + " -> " + dut.lane(j)->id().string());
+        ExpectSameRoutes(maliput::routing::DeriveLaneSRoutes(start, end, max_length),
+                         dut.DeriveLaneSRoutes(start, end, max_length));
+      }
+    }
+  }
+}
+
+// The shortest routes must be the shortest of all the routes, in ascending length order.
+GTEST_TEST(LaneGraphTest, DeriveShortestLaneSRoutes) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{3, 3, 1, 3.7, 60., true, true});
+  const LaneGraph dut(road_network->road_geometry());
+  const api::Lane* start_lane = road_network->road_geometry()->ById().GetLane(LaneId("l:r0_0_1_0_f_0"));
+  const api::Lane* end_lane = road_network->road_geometry()->ById().GetLane(LaneId("l:r1_2_2_2_f_0"));
+  ASSERT_NE(nullptr, start_lane);
+  ASSERT_NE(nullptr, end_lane);
+  const api::RoadPosition start(start_lane, api::LanePosition(10., 0., 0.));
+  const api::RoadPosition end(end_lane, api::LanePosition(20., 0., 0.));
+  constexpr double kMaxLength{400.};
+  const auto route_length = [](const LaneSRoute& route) {
+    double length{0.};
+    for (const api::LaneSRange& range : route.ranges()) {
+      length += std::abs(range.s_range().s1() - range.s_range().s0());
+    }
+    return length;
+  };
+
+  std::vector<double> lengths;
+  for (const LaneSRoute& route : dut.DeriveLaneSRoutes(start, end, kMaxLength)) {
+    lengths.push_back(route_length(route));
+  }
+  // At least through the center intersection and around it, on either side.
+  ASSERT_GE(lengths.size(), 3u);
+  std::sort(lengths.begin(), lengths.end());
+  for (const int max_num_routes : {1, 3}) {
+    const std::vector<LaneSRoute> routes = dut.DeriveShortestLaneSRoutes(start, end, kMaxLength, max_num_routes);
+    ASSERT_EQ(static_cast<std::size_t>(max_num_routes), routes.size());
+    for (std::size_t i = 0; i < routes.size(); ++i) {
+      EXPECT_NEAR(lengths[i], route_length(routes[i]), kTolerance);
+    }
+  }
+  EXPECT_EQ(lengths.size(), dut.DeriveShortestLaneSRoutes(start, end, kMaxLength, 100000).size());
+
+  // Positions off the centerline, as api::RoadGeometry::ToRoadPosition() returns, rank the same. Straight and left
+  // turning connections differ by less than these offsets, so routes of close lengths are compared between every pair
+  // of lanes.
+  for (int i = 0; i < dut.num_lanes(); ++i) {
+    const api::RoadPosition offset_start(dut.lane(i), api::LanePosition(0.5 * dut.lane(i)->length(), 1.5, 1.));
+    for (int j = 0; j < dut.num_lanes(); ++j) {
+      const api::RoadPosition offset_end(dut.lane(j), api::LanePosition(0.5 * dut.lane(j)->length(), -1.5, 2.));
+      std::vector<double> offset_lengths;
+      for (const LaneSRoute& route : dut.DeriveLaneSRoutes(offset_start, offset_end, 150.)) {
+        offset_lengths.push_back(route_length(route));
+      }
+      std::sort(offset_lengths.begin(), offset_lengths.end());
+      const std::vector<LaneSRoute> routes = dut.DeriveShortestLaneSRoutes(offset_start, offset_end, 150., 3);
+      ASSERT_EQ(std::min<std::size_t>(3, offset_lengths.size()), routes.size());
+      for (std::size_t k = 0; k < routes.size(); ++k) {
+        EXPECT_NEAR(offset_lengths[k], route_length(routes[k]), kTolerance)
+            << dut.lane(i)->id().string() << " -> " << dut.lane(j)->id().string();
+      }
+    }
+  }
+  EXPECT_TRUE(dut.DeriveShortestLaneSRoutes(start, end, 0., 5).empty());
+  EXPECT_THROW(dut.DeriveShortestLaneSRoutes(start, end, kMaxLength, 0), common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
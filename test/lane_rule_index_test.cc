@@ -0,0 +1,117 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_rule_index.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/rules/discrete_value_rule.h>
+#include <maliput/api/rules/rule.h>
+#include <maliput/api/rules/speed_limit_rule.h>
+#include <maliput/base/manual_rulebook.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::LaneId;
+using api::LaneSRange;
+using api::LaneSRoute;
+using api::SRange;
+using api::rules::DiscreteValueRule;
+using api::rules::Rule;
+using api::rules::SpeedLimitRule;
+
+class LaneRuleIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    rulebook_.AddRule(SpeedLimitRule(SpeedLimitRule::Id("slow"), LaneSRange(LaneId("a"), SRange(0., 10.)),
+                                     SpeedLimitRule::Severity::kStrict, 0., 5.));
+    rulebook_.AddRule(SpeedLimitRule(SpeedLimitRule::Id("fast"), LaneSRange(LaneId("a"), SRange(30., 20.)),
+                                     SpeedLimitRule::Severity::kStrict, 0., 30.));
+    const Rule::State state{Rule::State::kStrict, {}, {}};
+    rulebook_.AddRule(DiscreteValueRule(
+        Rule::Id("yield"), Rule::TypeId("Yield"),
+        LaneSRoute({LaneSRange(LaneId("a"), SRange(5., 25.)), LaneSRange(LaneId("b"), SRange(0., 5.))}),
+        {DiscreteValueRule::DiscreteValue{state, "Yield"}}));
+  }
+
+  ManualRulebook rulebook_;
+};
+
+TEST_F(LaneRuleIndexTest, Constructor) {
+  EXPECT_THROW(LaneRuleIndex(nullptr), common::assertion_error);
+  const LaneRuleIndex dut(&rulebook_);
+  EXPECT_EQ(2, dut.num_lanes());
+}
+
+TEST_F(LaneRuleIndexTest, MatchesRulebook) {
+  const LaneRuleIndex dut(&rulebook_);
+  for (const LaneSRange& range :
+       {LaneSRange(LaneId("a"), SRange(0., 30.)), LaneSRange(LaneId("a"), SRange(11., 12.)),
+        LaneSRange(LaneId("a"), SRange(12., 11.)), LaneSRange(LaneId("a"), SRange(22., 23.)),
+        LaneSRange(LaneId("a"), SRange(26., 40.)), LaneSRange(LaneId("a"), SRange(31., 40.)),
+        LaneSRange(LaneId("a"), SRange(-5., -1.)), LaneSRange(LaneId("b"), SRange(6., 7.)),
+        LaneSRange(LaneId("c"), SRange(0., 1.))}) {
+    for (const double tolerance : {0., 1.5}) {
+      const api::rules::RoadRulebook::QueryResults expected = rulebook_.FindRules({range}, tolerance);
+      const api::rules::RoadRulebook::QueryResults results = dut.FindRules(range, tolerance);
+      EXPECT_EQ(expected.speed_limit.size(), results.speed_limit.size());
+      for (const auto& id_rule : expected.speed_limit) {
+        EXPECT_EQ(1u, results.speed_limit.count(id_rule.first));
+      }
+      EXPECT_EQ(expected.discrete_value_rules.size(), results.discrete_value_rules.size());
+      for (const auto& id_rule : expected.discrete_value_rules) {
+        EXPECT_EQ(1u, results.discrete_value_rules.count(id_rule.first));
+      }
+      EXPECT_TRUE(results.range_value_rules.empty());
+    }
+  }
+  EXPECT_THROW(dut.FindRules(LaneSRange(LaneId("a"), SRange(0., 1.)), -1.), common::assertion_error);
+}
+
+TEST_F(LaneRuleIndexTest, FindRulesForLane) {
+  const LaneRuleIndex dut(&rulebook_);
+  const api::rules::RoadRulebook::QueryResults lane_a = dut.FindRules(LaneId("a"));
+  EXPECT_EQ(2u, lane_a.speed_limit.size());
+  EXPECT_EQ(1u, lane_a.discrete_value_rules.size());
+  const api::rules::RoadRulebook::QueryResults lane_b = dut.FindRules(LaneId("b"));
+  EXPECT_TRUE(lane_b.speed_limit.empty());
+  EXPECT_EQ(1u, lane_b.discrete_value_rules.size());
+  EXPECT_TRUE(dut.FindRules(LaneId("c")).discrete_value_rules.empty());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
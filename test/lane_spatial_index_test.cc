@@ -0,0 +1,200 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_spatial_index.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/overlapping_type.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput/math/vector.h>
+
+#include "integration/overlapping_lanes.h"
+#include "integration/synthetic_road_network.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Expects the volume of every lane of @p road_geometry to be within its box in @p dut.
+void ExpectBoxesContainLanes(const api::RoadGeometry* road_geometry, const LaneSpatialIndex& dut) {
+  for (const auto& id_lane : road_geometry->ById().GetLanes()) {
+    const api::Lane* lane = id_lane.second;
+    const AxisAlignedBox& box = dut.GetLaneBox(lane);
+    for (double s = 0.; s <= lane->length(); s += 0.1) {
+      const api::RBounds r_bounds = lane->lane_bounds(s);
+      for (const double r : {r_bounds.min(), 0.5 * (r_bounds.min() + r_bounds.max()), r_bounds.max()}) {
+        const api::HBounds h_bounds = lane->elevation_bounds(s, r);
+        for (const double h : {h_bounds.min(), h_bounds.max()}) {
+          const math::Vector3 point = lane->ToInertialPosition(api::LanePosition(s, r, h)).xyz();
+          EXPECT_DOUBLE_EQ(0., box.SquaredDistance(point)) << lane->id().string() << " at s = " << s;
+        }
+      }
+    }
+  }
+}
+
+GTEST_TEST(AxisAlignedBoxTest, Queries) {
+  AxisAlignedBox dut;
+  EXPECT_TRUE(dut.empty);
+  dut.Extend(math::Vector3{0., 0., 0.});
+  dut.Extend(math::Vector3{2., 4., 6.});
+  EXPECT_FALSE(dut.empty);
+  EXPECT_EQ(math::Vector3(1., 2., 3.), dut.center());
+  EXPECT_DOUBLE_EQ(0., dut.SquaredDistance(math::Vector3{1., 1., 1.}));
+  EXPECT_DOUBLE_EQ(9. + 16., dut.SquaredDistance(math::Vector3{-3., 8., 3.}));
+
+  AxisAlignedBox other;
+  other.Extend(math::Vector3{2., 4., 6.});
+  other.Extend(math::Vector3{3., 5., 7.});
+  EXPECT_TRUE(dut.Intersects(other));
+  AxisAlignedBox disjoint;
+  disjoint.Extend(math::Vector3{2.1, 0., 0.});
+  EXPECT_FALSE(dut.Intersects(disjoint));
+}
+
+class LaneSpatialIndexTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumLanes{5};
+  static constexpr double kLength{50.};
+
+  void SetUp() override {
+    road_network_ = CreateDragwayRoadNetwork(DragwayBuildProperties{kNumLanes, kLength, 3.7, 1., 5.});
+    ASSERT_NE(nullptr, road_network_);
+    road_geometry_ = road_network_->road_geometry();
+  }
+
+  // @returns The ids of the lanes in @p results, sorted.
+  static std::vector<std::string> LaneIds(const std::vector<api::RoadPositionResult>& results) {
+    std::vector<std::string> lane_ids;
+    for (const api::RoadPositionResult& result : results) {
+      lane_ids.push_back(result.road_position.lane->id().string());
+    }
+    std::sort(lane_ids.begin(), lane_ids.end());
+    return lane_ids;
+  }
+
+  std::unique_ptr<api::RoadNetwork> road_network_;
+  const api::RoadGeometry* road_geometry_{};
+};
+
+TEST_F(LaneSpatialIndexTest, Preconditions) {
+  EXPECT_THROW(LaneSpatialIndex(nullptr), maliput::common::assertion_error);
+  EXPECT_THROW(LaneSpatialIndex(road_geometry_, 0.), maliput::common::assertion_error);
+  const LaneSpatialIndex dut(road_geometry_);
+  EXPECT_THROW(dut.FindRoadPositions(api::InertialPosition(0., 0., 0.), -1.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.GetLaneBox(nullptr), maliput::common::assertion_error);
+}
+
+TEST_F(LaneSpatialIndexTest, BoxesContainLanes) {
+  const LaneSpatialIndex dut(road_geometry_, 5.);
+  ASSERT_EQ(kNumLanes, dut.num_lanes());
+  ExpectBoxesContainLanes(road_geometry_, dut);
+}
+
+// Lanes bulge between samples at the outer edge of the turns, beyond where their centerlines do.
+GTEST_TEST(LaneSpatialIndexCurvedTest, BoxesContainLanes) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{2, 2, 2, 3.7, 60., true, true});
+  ASSERT_NE(nullptr, road_network);
+  for (const double sampling_step : {1., 10.}) {
+    const LaneSpatialIndex dut(road_network->road_geometry(), sampling_step);
+    ExpectBoxesContainLanes(road_network->road_geometry(), dut);
+  }
+}
+
+TEST_F(LaneSpatialIndexTest, PrunesLanes) {
+  const LaneSpatialIndex dut(road_geometry_);
+  EXPECT_EQ(static_cast<std::size_t>(kNumLanes), dut.FindLanesNear(math::Vector3{25., 0., 0.}, 100.).size());
+  EXPECT_TRUE(dut.FindLanesNear(math::Vector3{1000., 0., 0.}, 1.).empty());
+  EXPECT_GT(static_cast<std::size_t>(kNumLanes), dut.FindLanesNear(math::Vector3{25., 0., 0.}, 0.1).size());
+
+  AxisAlignedBox far_box;
+  far_box.Extend(math::Vector3{1000., 1000., 0.});
+  far_box.Extend(math::Vector3{1001., 1001., 1.});
+  EXPECT_TRUE(dut.FindLanesIntersecting(far_box).empty());
+  AxisAlignedBox road_box;
+  road_box.Extend(math::Vector3{-1., -100., 0.});
+  road_box.Extend(math::Vector3{1., 100., 1.});
+  EXPECT_EQ(static_cast<std::size_t>(kNumLanes), dut.FindLanesIntersecting(road_box).size());
+}
+
+TEST_F(LaneSpatialIndexTest, MatchesFindRoadPositions) {
+  const LaneSpatialIndex dut(road_geometry_);
+  for (const double x : {-10., 0., 12.5, 49., 70.}) {
+    for (const double y : {-12., -3., 0., 2., 9.}) {
+      for (const double radius : {0., 0.5, 3., 20.}) {
+        const api::InertialPosition inertial_position(x, y, 1.);
+        EXPECT_EQ(LaneIds(road_geometry_->FindRoadPositions(inertial_position, radius)),
+                  LaneIds(dut.FindRoadPositions(inertial_position, radius)))
+            << "at " << inertial_position << " with radius " << radius;
+      }
+    }
+  }
+}
+
+TEST_F(LaneSpatialIndexTest, MatchesFindOverlappingLanesIn) {
+  constexpr double kSamplingStep{0.5};
+  const LaneSpatialIndex dut(road_geometry_);
+  EXPECT_THROW(dut.FindOverlappingLanesIn(math::BoundingBox(math::Vector3{0., 0., 0.}, math::Vector3{1., 1., 1.},
+                                                            math::RollPitchYaw(0., 0., 0.), 1e-6),
+                                          math::OverlappingType::kIntersected, 0.),
+               maliput::common::assertion_error);
+  for (const double x : {-10., 0., 25., 70.}) {
+    for (const double size : {0.1, 4., 60., 200.}) {
+      for (const double yaw : {0., 0.3}) {
+        const math::BoundingBox box(math::Vector3{x, 2., 1.}, math::Vector3{size, size, size},
+                                    math::RollPitchYaw(0., 0., yaw), 1e-6);
+        for (const math::OverlappingType overlapping_type :
+             {math::OverlappingType::kDisjointed, math::OverlappingType::kIntersected,
+              math::OverlappingType::kContained}) {
+          // Lanes are listed in the same order too.
+          const std::vector<const api::Lane*> expected =
+              FindOverlappingLanesIn(road_geometry_, box, overlapping_type, kSamplingStep);
+          const std::vector<const api::Lane*> lanes = dut.FindOverlappingLanesIn(box, overlapping_type, kSamplingStep);
+          EXPECT_EQ(expected, lanes) << "box at x = " << x << " of size " << size << " and yaw " << yaw << " with "
+                                     << static_cast<int>(overlapping_type) << " overlapping";
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,89 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/lane_volume.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class LaneVolumeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    road_network_ = CreateDragwayRoadNetwork(DragwayBuildProperties{1, 50., 3.7, 1., 5.});
+    ASSERT_NE(nullptr, road_network_);
+    lane_ = road_network_->road_geometry()->junction(0)->segment(0)->lane(0);
+  }
+
+  std::unique_ptr<api::RoadNetwork> road_network_;
+  const api::Lane* lane_{};
+};
+
+TEST_F(LaneVolumeTest, SampleLaneCrossSection) {
+  EXPECT_THROW(SampleLaneCrossSection(nullptr, 0., api::RBounds(-1., 1.)), maliput::common::assertion_error);
+
+  const LaneCrossSection dut = SampleLaneCrossSection(lane_, 10., lane_->lane_bounds(10.));
+  EXPECT_DOUBLE_EQ(10., dut.s);
+  for (int i = 0; i < LaneCrossSection::kNumCorners; ++i) {
+    const api::LanePosition& lane_corner = dut.lane_corners[i];
+    EXPECT_DOUBLE_EQ(10., lane_corner.s());
+    EXPECT_DOUBLE_EQ(0., (lane_->ToInertialPosition(lane_corner).xyz() - dut.corners[i]).norm());
+  }
+  EXPECT_DOUBLE_EQ(-1.85, dut.lane_corners.front().r());
+  EXPECT_DOUBLE_EQ(1.85, dut.lane_corners.back().r());
+  EXPECT_DOUBLE_EQ(5., dut.lane_corners.back().h());
+}
+
+// Straight lanes of constant bounds lie within the convex hull of any two of their cross sections.
+TEST_F(LaneVolumeTest, StraightLanesDoNotDeviate) {
+  const LaneCrossSection first = SampleLaneCrossSection(lane_, 0., lane_->lane_bounds(0.));
+  const LaneCrossSection second = SampleLaneCrossSection(lane_, 50., lane_->lane_bounds(50.));
+  EXPECT_NEAR(0., ComputeLaneVolumeDeviation(first, second), 1e-12);
+}
+
+// Wider bounds at one end grow the deviation by their variation.
+TEST_F(LaneVolumeTest, BoundsVariationIsAdded) {
+  const LaneCrossSection first = SampleLaneCrossSection(lane_, 0., api::RBounds(-1., 1.));
+  const LaneCrossSection second = SampleLaneCrossSection(lane_, 50., api::RBounds(-2., 2.));
+  EXPECT_NEAR(1., ComputeLaneVolumeDeviation(first, second), 1e-12);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,133 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/latency_histogram.h"
+
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/json_writer.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(LatencyHistogramTest, Empty) {
+  const LatencyHistogram dut;
+  EXPECT_EQ(0u, dut.count());
+  EXPECT_EQ(0., dut.Percentile(50.));
+  const LatencySummary summary = dut.Summarize();
+  EXPECT_EQ(0u, summary.count);
+  EXPECT_EQ(0., summary.max);
+  EXPECT_TRUE(dut.NonEmptyBuckets().empty());
+  EXPECT_THROW(dut.Percentile(-1.), maliput::common::assertion_error);
+  EXPECT_THROW(dut.Percentile(101.), maliput::common::assertion_error);
+}
+
+GTEST_TEST(LatencyHistogramTest, SmallLatenciesAreExact) {
+  LatencyHistogram dut;
+  for (int i = 1; i <= 100; ++i) {
+    dut.Record(i * 1e-9);
+  }
+  const LatencySummary summary = dut.Summarize();
+  EXPECT_EQ(100u, summary.count);
+  EXPECT_NEAR(50.5e-9, summary.mean, 1e-15);
+  EXPECT_NEAR(50e-9, summary.p50, 1e-15);
+  EXPECT_NEAR(95e-9, summary.p95, 1e-15);
+  EXPECT_NEAR(99e-9, summary.p99, 1e-15);
+  EXPECT_NEAR(100e-9, summary.max, 1e-15);
+  EXPECT_EQ(100u, dut.NonEmptyBuckets().size());
+}
+
+GTEST_TEST(LatencyHistogramTest, BoundedRelativeError) {
+  LatencyHistogram dut;
+  // From 1 us to 1 s.
+  for (int i = 1; i <= 1000000; i += 7) {
+    dut.Record(i * 1e-6);
+  }
+  const LatencySummary summary = dut.Summarize();
+  constexpr double kRelativeTolerance{1. / 64.};
+  EXPECT_NEAR(0.5, summary.p50, 0.5 * kRelativeTolerance);
+  EXPECT_NEAR(0.95, summary.p95, 0.95 * kRelativeTolerance);
+  EXPECT_NEAR(0.99, summary.p99, 0.99 * kRelativeTolerance);
+  EXPECT_NEAR(1., summary.max, 1e-9);
+  EXPECT_NEAR(0.5, summary.mean, 1e-3);
+  // Buckets are ordered and don't overlap.
+  const std::vector<LatencyHistogram::Bucket> buckets = dut.NonEmptyBuckets();
+  for (std::size_t i = 1; i < buckets.size(); ++i) {
+    EXPECT_LT(buckets[i - 1].upper, buckets[i].lower);
+  }
+}
+
+GTEST_TEST(LatencyHistogramTest, OutOfRangeLatencies) {
+  LatencyHistogram dut;
+  dut.Record(-1.);
+  dut.Record(1e6);
+  EXPECT_EQ(2u, dut.count());
+  EXPECT_EQ(0., dut.Percentile(0.));
+  EXPECT_GT(dut.Summarize().max, 1000.);
+}
+
+GTEST_TEST(LatencyHistogramTest, Merge) {
+  LatencyHistogram first;
+  LatencyHistogram second;
+  first.Record(1e-3);
+  second.Record(3e-3);
+  second.Record(5e-3);
+  first.Merge(second);
+  const LatencySummary summary = first.Summarize();
+  EXPECT_EQ(3u, summary.count);
+  EXPECT_NEAR(3e-3, summary.mean, 1e-12);
+  EXPECT_NEAR(5e-3, summary.max, 1e-12);
+}
+
+GTEST_TEST(LatencyHistogramTest, WriteLatencyHistograms) {
+  std::map<std::string, LatencyHistogram> histograms;
+  histograms["ToRoadPosition"].Record(10e-9);
+  histograms["ToRoadPosition"].Record(10e-9);
+  histograms["GetLaneLength"].Record(20e-9);
+  std::stringstream ss;
+  JsonWriter writer(&ss);
+  WriteLatencyHistograms(histograms, &writer);
+  EXPECT_EQ(
+      "{\"GetLaneLength\":{\"count\":1,\"mean\":2e-08,\"p50\":2e-08,\"p95\":2e-08,\"p99\":2e-08,\"max\":2e-08,"
+      "\"buckets\":[{\"lower\":2e-08,\"upper\":2e-08,\"count\":1}]},"
+      "\"ToRoadPosition\":{\"count\":2,\"mean\":1e-08,\"p50\":1e-08,\"p95\":1e-08,\"p99\":1e-08,\"max\":1e-08,"
+      "\"buckets\":[{\"lower\":1e-08,\"upper\":1e-08,\"count\":2}]}}",
+      ss.str());
+  EXPECT_THROW(WriteLatencyHistograms(histograms, nullptr), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
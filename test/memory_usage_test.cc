@@ -0,0 +1,78 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/memory_usage.h"
+
+#include <cstring>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(MemoryUsageTest, ResidentMemory) {
+  const std::size_t current = GetCurrentResidentMemory();
+  EXPECT_GT(current, 0u);
+  EXPECT_GE(GetPeakResidentMemory(), current);
+}
+
+GTEST_TEST(MemoryUsageTest, PeakResidentMemoryGrows) {
+  ResetPeakResidentMemory();
+  const std::size_t initial_resident_memory = GetCurrentResidentMemory();
+  static constexpr std::size_t kSize{64 * 1024 * 1024};
+  {
+    std::unique_ptr<char[]> buffer(new char[kSize]);
+    // Touches the pages so they become resident.
+    std::memset(buffer.get(), 1, kSize);
+  }
+  EXPECT_GE(GetPeakResidentMemory(), initial_resident_memory + kSize / 2);
+}
+
+GTEST_TEST(AllocationTrackerTest, Counters) {
+  AllocationTracker::ResetPeak();
+  const AllocationStats start = AllocationTracker::Snapshot();
+  AllocationTracker::RecordAllocation(100);
+  AllocationTracker::RecordAllocation(50);
+  AllocationTracker::RecordDeallocation(100);
+  AllocationTracker::RecordAllocation(20);
+  const AllocationStats dut = AllocationTracker::Snapshot() - start;
+  EXPECT_EQ(3u, dut.count);
+  EXPECT_EQ(170u, dut.bytes);
+  EXPECT_EQ(1u, dut.free_count);
+  EXPECT_EQ(100u, dut.free_bytes);
+  EXPECT_EQ(150u, dut.peak_live_bytes);
+  AllocationTracker::RecordDeallocation(50);
+  AllocationTracker::RecordDeallocation(20);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
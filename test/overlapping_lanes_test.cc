@@ -0,0 +1,238 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/overlapping_lanes.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/assertion_error.h>
+#include <maliput/math/bounding_box.h>
+#include <maliput/math/roll_pitch_yaw.h>
+#include <maliput_object/api/object.h>
+#include <maliput_object/base/manual_object_book.h>
+#include <maliput_object/base/simple_object_query.h>
+
+#include "integration/synthetic_road_network.h"
+#include "integration/thread_pool.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class OverlappingLanesTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumLanes{4};
+  static constexpr double kLength{40.};
+  static constexpr double kLaneWidth{4.};
+  static constexpr double kSamplingStep{0.5};
+  static constexpr double kTolerance{1e-6};
+
+  void SetUp() override {
+    road_network_ = CreateDragwayRoadNetwork(DragwayBuildProperties{kNumLanes, kLength, kLaneWidth, 1., 5.});
+    ASSERT_NE(nullptr, road_network_);
+    road_geometry_ = road_network_->road_geometry();
+    for (int i = 0; i < kNumLanes; ++i) {
+      lanes_.push_back(road_geometry_->junction(0)->segment(0)->lane(i));
+    }
+  }
+
+  // @returns A box centered at @p position with @p size.
+  static math::BoundingBox MakeBox(const math::Vector3& position, const math::Vector3& size) {
+    return math::BoundingBox(position, size, math::RollPitchYaw(0., 0., 0.), kTolerance);
+  }
+
+  std::unique_ptr<api::RoadNetwork> road_network_;
+  const api::RoadGeometry* road_geometry_{};
+  std::vector<const api::Lane*> lanes_;
+};
+
+TEST_F(OverlappingLanesTest, Preconditions) {
+  const math::BoundingBox box = MakeBox(math::Vector3(0., 0., 0.), math::Vector3(1., 1., 1.));
+  EXPECT_THROW(ComputeLaneOverlapping(nullptr, box, kSamplingStep), maliput::common::assertion_error);
+  EXPECT_THROW(ComputeLaneOverlapping(lanes_[0], box, 0.), maliput::common::assertion_error);
+  EXPECT_THROW(FindOverlappingLanesIn(nullptr, box, math::OverlappingType::kIntersected, kSamplingStep),
+               maliput::common::assertion_error);
+  EXPECT_THROW(FindOverlappingLanesIn(road_geometry_, box, math::OverlappingType::kIntersected, -1.),
+               maliput::common::assertion_error);
+}
+
+TEST_F(OverlappingLanesTest, ClassifiesLanes) {
+  const math::BoundingBox whole_road = MakeBox(math::Vector3(kLength / 2., 0., 0.), math::Vector3(100., 100., 20.));
+  const math::BoundingBox far_away = MakeBox(math::Vector3(1000., 1000., 0.), math::Vector3(1., 1., 1.));
+  // Covers half of the length of the first lane.
+  const api::InertialPosition first_lane_center =
+      lanes_[0]->ToInertialPosition(api::LanePosition(kLength / 4., 0., 0.));
+  const math::BoundingBox part_of_first_lane =
+      MakeBox(first_lane_center.xyz(), math::Vector3(kLength / 2., kLaneWidth / 2., 1.));
+  for (const api::Lane* lane : lanes_) {
+    EXPECT_EQ(math::OverlappingType::kContained, ComputeLaneOverlapping(lane, whole_road, kSamplingStep));
+    EXPECT_EQ(math::OverlappingType::kDisjointed, ComputeLaneOverlapping(lane, far_away, kSamplingStep));
+  }
+  EXPECT_EQ(math::OverlappingType::kIntersected, ComputeLaneOverlapping(lanes_[0], part_of_first_lane, kSamplingStep));
+  EXPECT_EQ(math::OverlappingType::kDisjointed, ComputeLaneOverlapping(lanes_[2], part_of_first_lane, kSamplingStep));
+  // Smaller than the sampling step and inside of the first lane's volume.
+  const math::BoundingBox inside_first_lane = MakeBox(
+      lanes_[0]->ToInertialPosition(api::LanePosition(kLength / 3., 0.1, 1.)).xyz(), math::Vector3(0.1, 0.1, 0.1));
+  EXPECT_EQ(math::OverlappingType::kIntersected, ComputeLaneOverlapping(lanes_[0], inside_first_lane, kSamplingStep));
+  // Above the surface of every lane.
+  const math::BoundingBox above_surface = MakeBox(math::Vector3(kLength / 2., 0., 3.), math::Vector3(1., 100., 1.));
+  for (const api::Lane* lane : lanes_) {
+    EXPECT_EQ(math::OverlappingType::kIntersected, ComputeLaneOverlapping(lane, above_surface, kSamplingStep));
+  }
+}
+
+TEST_F(OverlappingLanesTest, MatchesSimpleObjectQuery) {
+  const object::ManualObjectBook<math::Vector3> object_book;
+  const object::SimpleObjectQuery object_query(road_network_.get(), &object_book);
+  const api::InertialPosition first_lane_center =
+      lanes_[0]->ToInertialPosition(api::LanePosition(kLength / 3., 0.1, 1.));
+  const double lane_boundary_y = lanes_[0]->ToInertialPosition(api::LanePosition(0., kLaneWidth / 2., 0.)).y();
+  const std::vector<std::pair<math::Vector3, math::Vector3>> boxes{
+      // Whole road.
+      {math::Vector3(kLength / 2., 0., 0.), math::Vector3(100., 100., 20.)},
+      // Far away.
+      {math::Vector3(1000., 1000., 0.), math::Vector3(1., 1., 1.)},
+      // Half of the road, across all the lanes.
+      {math::Vector3(0., 0., 0.), math::Vector3(kLength, 100., 1.)},
+      // Smaller than the sampling step, inside of the first lane.
+      {first_lane_center.xyz(), math::Vector3(0.1, 0.1, 0.1)},
+      // Smaller than the sampling step, across the boundary between the first two lanes.
+      {math::Vector3(kLength / 3., lane_boundary_y, 1.), math::Vector3(0.2, 0.2, 0.2)},
+      // Above the lane surface.
+      {math::Vector3(kLength / 2., 0., 3.), math::Vector3(1., 100., 1.)},
+      // Below the lane surface.
+      {math::Vector3(kLength / 2., 0., -3.), math::Vector3(1., 100., 1.)},
+  };
+  for (const auto& box : boxes) {
+    const object::api::Object<math::Vector3> object(
+        object::api::Object<math::Vector3>::Id{"box"}, std::map<std::string, std::string>{},
+        std::make_unique<math::BoundingBox>(MakeBox(box.first, box.second)));
+    for (const math::OverlappingType overlapping_type :
+         {math::OverlappingType::kDisjointed, math::OverlappingType::kIntersected, math::OverlappingType::kContained}) {
+      std::vector<const api::Lane*> expected = object_query.FindOverlappingLanesIn(&object, overlapping_type);
+      std::sort(expected.begin(), expected.end());
+      for (const int num_threads : {1, 4}) {
+        ThreadPool thread_pool(num_threads);
+        std::vector<const api::Lane*> lanes = FindOverlappingLanesIn(road_geometry_, object.bounding_region(),
+                                                                     overlapping_type, kSamplingStep, &thread_pool);
+        std::sort(lanes.begin(), lanes.end());
+        EXPECT_EQ(expected, lanes) << "box at " << box.first << " of size " << box.second << " with "
+                                   << static_cast<int>(overlapping_type) << " overlapping";
+      }
+    }
+  }
+}
+
+TEST_F(OverlappingLanesTest, SameResultForAnyNumberOfThreads) {
+  // Covers the first half of the road, across all the lanes.
+  const math::BoundingBox box = MakeBox(math::Vector3(0., 0., 0.), math::Vector3(kLength, 100., 1.));
+  for (const math::OverlappingType overlapping_type :
+       {math::OverlappingType::kDisjointed, math::OverlappingType::kIntersected, math::OverlappingType::kContained}) {
+    const std::vector<const api::Lane*> expected =
+        FindOverlappingLanesIn(road_geometry_, box, overlapping_type, kSamplingStep);
+    for (const int num_threads : {1, 2, 3, 8}) {
+      ThreadPool thread_pool(num_threads);
+      EXPECT_EQ(expected, FindOverlappingLanesIn(road_geometry_, box, overlapping_type, kSamplingStep, &thread_pool));
+    }
+  }
+  EXPECT_EQ(lanes_, FindOverlappingLanesIn(road_geometry_, box, math::OverlappingType::kIntersected, kSamplingStep));
+}
+
+// Turning lanes curve, so their chords cut through the outer edge of their volume and the inner edge bulges past them.
+GTEST_TEST(OverlappingLanesCurvedTest, MatchesSimpleObjectQuery) {
+  static constexpr int kNumTurningLanes{4};
+  static constexpr double kTolerance{1e-6};
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{2, 2, 2, 3.7, 60., true, true});
+  ASSERT_NE(nullptr, road_network);
+  const api::RoadGeometry* road_geometry = road_network->road_geometry();
+  std::vector<const api::Lane*> turning_lanes;
+  for (int i = 0; i < road_geometry->num_junctions(); ++i) {
+    const api::Junction* junction = road_geometry->junction(i);
+    for (int j = 0; j < junction->num_segments(); ++j) {
+      const api::Segment* segment = junction->segment(j);
+      for (int k = 0; k < segment->num_lanes(); ++k) {
+        const api::Lane* lane = segment->lane(k);
+        const api::Rotation start = lane->GetOrientation(api::LanePosition(0., 0., 0.));
+        const api::Rotation end = lane->GetOrientation(api::LanePosition(lane->length(), 0., 0.));
+        if (start.Distance(end) > 1. && static_cast<int>(turning_lanes.size()) < kNumTurningLanes) {
+          turning_lanes.push_back(lane);
+        }
+      }
+    }
+  }
+  ASSERT_EQ(kNumTurningLanes, static_cast<int>(turning_lanes.size()));
+
+  const object::ManualObjectBook<math::Vector3> object_book;
+  const object::SimpleObjectQuery object_query(road_network.get(), &object_book);
+  for (const api::Lane* turning_lane : turning_lanes) {
+    const double s = turning_lane->length() / 2.;
+    const api::RBounds r_bounds = turning_lane->lane_bounds(s);
+    const math::RollPitchYaw rpy = turning_lane->GetOrientation(api::LanePosition(s, 0., 0.)).rpy();
+    // Boxes on the edges of the lane, both smaller and larger than the sampling steps.
+    for (const double r : {r_bounds.min(), r_bounds.max()}) {
+      for (const double size : {0.2, 2., 20.}) {
+        const math::Vector3 position = turning_lane->ToInertialPosition(api::LanePosition(s, r, 1.)).xyz();
+        const object::api::Object<math::Vector3> object(
+            object::api::Object<math::Vector3>::Id{"box"}, std::map<std::string, std::string>{},
+            std::make_unique<math::BoundingBox>(position, math::Vector3(size, size, size), rpy, kTolerance));
+        for (const math::OverlappingType overlapping_type :
+             {math::OverlappingType::kDisjointed, math::OverlappingType::kIntersected,
+              math::OverlappingType::kContained}) {
+          std::vector<const api::Lane*> expected = object_query.FindOverlappingLanesIn(&object, overlapping_type);
+          std::sort(expected.begin(), expected.end());
+          for (const double sampling_step : {0.5, 10.}) {
+            std::vector<const api::Lane*> overlapping_lanes =
+                FindOverlappingLanesIn(road_geometry, object.bounding_region(), overlapping_type, sampling_step);
+            std::sort(overlapping_lanes.begin(), overlapping_lanes.end());
+            EXPECT_EQ(expected, overlapping_lanes)
+                << "box of size " << size << " at r = " << r << " of " << turning_lane->id().string() << " with "
+                << static_cast<int>(overlapping_type) << " overlapping every " << sampling_step << " m";
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,126 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/phase_profiler.h"
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(PhaseProfilerTest, NestedPhases) {
+  PhaseProfiler dut;
+  {
+    const PhaseProfiler::ScopedPhase load(&dut, "load");
+    {
+      const PhaseProfiler::ScopedPhase resolve(&dut, "resolve");
+    }
+    {
+      const PhaseProfiler::ScopedPhase build(&dut, "build");
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  ASSERT_EQ(1u, dut.phases().size());
+  const PhaseProfiler::Phase& load = dut.phases().front();
+  EXPECT_EQ("load", load.name);
+  EXPECT_EQ(1, load.count);
+  ASSERT_EQ(2u, load.children.size());
+  EXPECT_EQ("resolve", load.children[0].name);
+  EXPECT_EQ("build", load.children[1].name);
+  EXPECT_GE(load.children[1].duration, 0.010);
+  EXPECT_GE(load.duration, load.children[0].duration + load.children[1].duration);
+}
+
+GTEST_TEST(PhaseProfilerTest, RepeatedPhasesAreMerged) {
+  PhaseProfiler dut;
+  dut.Begin("load");
+  for (int i = 0; i < 3; ++i) {
+    dut.Begin("resolve");
+    dut.End();
+  }
+  dut.End();
+  dut.Begin("load");
+  dut.End();
+  ASSERT_EQ(1u, dut.phases().size());
+  EXPECT_EQ(2, dut.phases().front().count);
+  ASSERT_EQ(1u, dut.phases().front().children.size());
+  EXPECT_EQ(3, dut.phases().front().children.front().count);
+}
+
+GTEST_TEST(PhaseProfilerTest, NullProfilerIsAllowed) {
+  EXPECT_NO_THROW({ const PhaseProfiler::ScopedPhase phase(nullptr, "phase"); });
+}
+
+GTEST_TEST(PhaseProfilerTest, Reset) {
+  PhaseProfiler dut;
+  dut.Begin("load");
+  EXPECT_THROW(dut.Reset(), maliput::common::assertion_error);
+  dut.End();
+  EXPECT_THROW(dut.End(), maliput::common::assertion_error);
+  dut.Reset();
+  EXPECT_TRUE(dut.phases().empty());
+}
+
+GTEST_TEST(PhaseProfilerTest, Print) {
+  PhaseProfiler dut;
+  dut.Begin("load");
+  dut.Begin("build");
+  dut.End();
+  dut.End();
+  std::stringstream ss;
+  dut.Print(&ss);
+  const std::string output = ss.str();
+  EXPECT_EQ(0u, output.find("load: "));
+  EXPECT_NE(std::string::npos, output.find("\n  build: "));
+}
+
+GTEST_TEST(PhaseProfilerTest, WriteJson) {
+  PhaseProfiler dut;
+  dut.Begin("load");
+  dut.Begin("build");
+  dut.End();
+  dut.End();
+  std::stringstream ss;
+  JsonWriter writer(&ss);
+  dut.WriteJson(&writer);
+  const std::string output = ss.str();
+  EXPECT_EQ(0u, output.find(R"([{"name":"load","duration":)"));
+  EXPECT_NE(std::string::npos, output.find(R"("children":[{"name":"build","duration":)"));
+  EXPECT_NE(std::string::npos, output.find(R"("count":1,"children":[]}]}])"));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
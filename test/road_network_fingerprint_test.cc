@@ -0,0 +1,128 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_network_fingerprint.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+// Computes the fingerprint of a dragway RoadNetwork built from `build_properties`.
+std::uint64_t DragwayFingerprint(const DragwayBuildProperties& build_properties) {
+  return ComputeRoadNetworkFingerprint(MaliputImplementation::kDragway, build_properties, {}, {}, {});
+}
+
+// Computes the fingerprint of a malidrive RoadNetwork built from `build_properties`.
+std::uint64_t MalidriveFingerprint(const MalidriveBuildProperties& build_properties) {
+  return ComputeRoadNetworkFingerprint(MaliputImplementation::kMalidrive, {}, {}, build_properties, {});
+}
+
+GTEST_TEST(ComputeRoadNetworkFingerprintTest, IsDeterministic) {
+  const DragwayBuildProperties build_properties{3, 100., 3.5, 1., 5.};
+  EXPECT_EQ(DragwayFingerprint(build_properties), DragwayFingerprint(build_properties));
+}
+
+GTEST_TEST(ComputeRoadNetworkFingerprintTest, DependsOnEveryDragwayProperty) {
+  const DragwayBuildProperties kBase{3, 100., 3.5, 1., 5.};
+  const std::uint64_t base_fingerprint = DragwayFingerprint(kBase);
+  EXPECT_NE(base_fingerprint, DragwayFingerprint({4, 100., 3.5, 1., 5.}));
+  EXPECT_NE(base_fingerprint, DragwayFingerprint({3, 101., 3.5, 1., 5.}));
+  EXPECT_NE(base_fingerprint, DragwayFingerprint({3, 100., 3.6, 1., 5.}));
+  EXPECT_NE(base_fingerprint, DragwayFingerprint({3, 100., 3.5, 1.5, 5.}));
+  EXPECT_NE(base_fingerprint, DragwayFingerprint({3, 100., 3.5, 1., 6.}));
+}
+
+GTEST_TEST(ComputeRoadNetworkFingerprintTest, IgnoresPropertiesOfOtherImplementations) {
+  const DragwayBuildProperties dragway_build_properties{};
+  MalidriveBuildProperties malidrive_build_properties{};
+  malidrive_build_properties.xodr_file_path = "TShapeRoad.xodr";
+  EXPECT_EQ(ComputeRoadNetworkFingerprint(MaliputImplementation::kDragway, dragway_build_properties, {}, {}, {}),
+            ComputeRoadNetworkFingerprint(MaliputImplementation::kDragway, dragway_build_properties, {},
+                                          malidrive_build_properties, {}));
+}
+
+GTEST_TEST(ComputeRoadNetworkFingerprintTest, DependsOnMalidriveProperties) {
+  MalidriveBuildProperties build_properties{};
+  build_properties.xodr_file_path = "TShapeRoad.xodr";
+  const std::uint64_t base_fingerprint = MalidriveFingerprint(build_properties);
+
+  MalidriveBuildProperties other_build_properties = build_properties;
+  other_build_properties.linear_tolerance = 1e-3;
+  EXPECT_NE(base_fingerprint, MalidriveFingerprint(other_build_properties));
+
+  other_build_properties = build_properties;
+  other_build_properties.build_policy = "parallel";
+  other_build_properties.number_of_threads = 4;
+  EXPECT_EQ(base_fingerprint, MalidriveFingerprint(other_build_properties));
+
+  other_build_properties = build_properties;
+  other_build_properties.road_rule_book_file = "TShapeRoad.yaml";
+  EXPECT_NE(base_fingerprint, MalidriveFingerprint(other_build_properties));
+
+  other_build_properties = build_properties;
+  other_build_properties.geometry_only = true;
+  EXPECT_NE(base_fingerprint, MalidriveFingerprint(other_build_properties));
+}
+
+GTEST_TEST(ComputeRoadNetworkFingerprintTest, DependsOnMapFileContents) {
+  const std::filesystem::path xodr_file_path =
+      std::filesystem::temp_directory_path() / "road_network_fingerprint_test.xodr";
+  {
+    std::ofstream xodr_file(xodr_file_path);
+    xodr_file << "<OpenDRIVE/>";
+  }
+  MalidriveBuildProperties build_properties{};
+  build_properties.xodr_file_path = xodr_file_path.string();
+  const std::uint64_t original_fingerprint = MalidriveFingerprint(build_properties);
+  EXPECT_EQ(original_fingerprint, MalidriveFingerprint(build_properties));
+
+  {
+    std::ofstream xodr_file(xodr_file_path, std::ios::app);
+    xodr_file << "\n";
+  }
+  EXPECT_NE(original_fingerprint, MalidriveFingerprint(build_properties));
+  std::filesystem::remove(xodr_file_path);
+}
+
+GTEST_TEST(FingerprintToStringTest, IsZeroPaddedHexadecimal) {
+  EXPECT_EQ("0000000000000000", FingerprintToString(0));
+  EXPECT_EQ("00000000000000ff", FingerprintToString(255));
+  EXPECT_EQ("ffffffffffffffff", FingerprintToString(0xffffffffffffffffULL));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,182 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_network_registry.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+RoadNetworkDescriptor MakeDragwayDescriptor(int num_lanes) {
+  RoadNetworkDescriptor descriptor;
+  descriptor.maliput_implementation = MaliputImplementation::kDragway;
+  descriptor.dragway_build_properties.num_lanes = num_lanes;
+  return descriptor;
+}
+
+GTEST_TEST(RoadNetworkKeyTest, Normalization) {
+  RoadNetworkDescriptor descriptor = MakeDragwayDescriptor(2);
+  const std::string key = RoadNetworkKey(descriptor);
+  // Properties of other implementations are ignored.
+  descriptor.malidrive_build_properties.xodr_file_path = "ArcLane.xodr";
+  EXPECT_EQ(key, RoadNetworkKey(descriptor));
+  descriptor.dragway_build_properties.num_lanes = 3;
+  EXPECT_NE(key, RoadNetworkKey(descriptor));
+
+  RoadNetworkDescriptor malidrive_descriptor;
+  malidrive_descriptor.maliput_implementation = MaliputImplementation::kMalidrive;
+  malidrive_descriptor.malidrive_build_properties.xodr_file_path = "ArcLane.xodr";
+  const std::string malidrive_key = RoadNetworkKey(malidrive_descriptor);
+  // The build policy doesn't affect the resulting RoadNetwork.
+  malidrive_descriptor.malidrive_build_properties.build_policy = "parallel";
+  malidrive_descriptor.malidrive_build_properties.number_of_threads = 4;
+  EXPECT_EQ(malidrive_key, RoadNetworkKey(malidrive_descriptor));
+  malidrive_descriptor.malidrive_build_properties.linear_tolerance = 1e-3;
+  EXPECT_NE(malidrive_key, RoadNetworkKey(malidrive_descriptor));
+}
+
+GTEST_TEST(RoadNetworkRegistryTest, SharesAndEvicts) {
+  RoadNetworkRegistry dut;
+  EXPECT_EQ(0, dut.size());
+  std::shared_ptr<const api::RoadNetwork> first = dut.GetOrLoad(MakeDragwayDescriptor(2));
+  ASSERT_NE(nullptr, first);
+  std::shared_ptr<const api::RoadNetwork> second = dut.GetOrLoad(MakeDragwayDescriptor(2));
+  EXPECT_EQ(first.get(), second.get());
+  std::shared_ptr<const api::RoadNetwork> other = dut.GetOrLoad(MakeDragwayDescriptor(3));
+  EXPECT_NE(first.get(), other.get());
+  EXPECT_EQ(2, dut.size());
+
+  first.reset();
+  EXPECT_TRUE(dut.Contains(MakeDragwayDescriptor(2)));
+  second.reset();
+  EXPECT_FALSE(dut.Contains(MakeDragwayDescriptor(2)));
+  EXPECT_EQ(1, dut.size());
+}
+
+GTEST_TEST(RoadNetworkRegistryTest, BuildsOnceUnderConcurrentRequests) {
+  std::atomic<int> builds{0};
+  RoadNetworkRegistry dut([&builds](const RoadNetworkDescriptor& descriptor) {
+    ++builds;
+    // Gives the other requests the chance to arrive while building.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return CreateDragwayRoadNetwork(descriptor.dragway_build_properties);
+  });
+  static constexpr int kNumThreads{8};
+  std::vector<std::shared_ptr<const api::RoadNetwork>> road_networks(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&dut, &road_networks, i]() { road_networks[i] = dut.GetOrLoad(MakeDragwayDescriptor(2)); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(1, builds.load());
+  for (const auto& road_network : road_networks) {
+    EXPECT_EQ(road_networks.front().get(), road_network.get());
+  }
+
+  // Once evicted, it is built again.
+  road_networks.clear();
+  EXPECT_EQ(0, dut.size());
+  EXPECT_NE(nullptr, dut.GetOrLoad(MakeDragwayDescriptor(2)));
+  EXPECT_EQ(2, builds.load());
+}
+
+GTEST_TEST(RoadNetworkRegistryTest, FailedBuildsAreNotRegistered) {
+  int builds{0};
+  RoadNetworkRegistry dut([&builds](const RoadNetworkDescriptor&) -> std::unique_ptr<api::RoadNetwork> {
+    ++builds;
+    throw std::runtime_error("Failed build.");
+  });
+  EXPECT_THROW(dut.GetOrLoad(MakeDragwayDescriptor(2)), std::runtime_error);
+  EXPECT_EQ(0, dut.size());
+  EXPECT_THROW(dut.GetOrLoad(MakeDragwayDescriptor(2)), std::runtime_error);
+  EXPECT_EQ(2, builds);
+}
+
+GTEST_TEST(RoadNetworkRegistryTest, RoadNetworksOutliveTheRegistry) {
+  std::shared_ptr<const api::RoadNetwork> road_network;
+  {
+    RoadNetworkRegistry dut;
+    road_network = dut.GetOrLoad(MakeDragwayDescriptor(2));
+  }
+  EXPECT_NE(nullptr, road_network->road_geometry());
+  road_network.reset();
+}
+
+GTEST_TEST(RoadNetworkRegistryTest, EditedFilesAreBuiltAgain) {
+  const std::filesystem::path yaml_file_path =
+      std::filesystem::temp_directory_path() / "road_network_registry_test.yaml";
+  {
+    std::ofstream yaml_file(yaml_file_path);
+    yaml_file << "maliput_multilane_builder: {}";
+  }
+  int builds{0};
+  RoadNetworkRegistry dut([&builds](const RoadNetworkDescriptor&) {
+    ++builds;
+    return CreateDragwayRoadNetwork(DragwayBuildProperties{});
+  });
+  RoadNetworkDescriptor descriptor;
+  descriptor.maliput_implementation = MaliputImplementation::kMultilane;
+  descriptor.multilane_build_properties.yaml_file = yaml_file_path.string();
+  const std::shared_ptr<const api::RoadNetwork> original = dut.GetOrLoad(descriptor);
+  EXPECT_EQ(original.get(), dut.GetOrLoad(descriptor).get());
+  EXPECT_EQ(1, builds);
+
+  {
+    std::ofstream yaml_file(yaml_file_path, std::ios::app);
+    yaml_file << "\n";
+  }
+  // The users of the original RoadNetwork keep it.
+  const std::shared_ptr<const api::RoadNetwork> edited = dut.GetOrLoad(descriptor);
+  EXPECT_NE(original.get(), edited.get());
+  EXPECT_EQ(2, builds);
+  EXPECT_EQ(2, dut.size());
+  std::filesystem::remove(yaml_file_path);
+}
+
+GTEST_TEST(RoadNetworkRegistryTest, Throws) {
+  EXPECT_THROW(RoadNetworkRegistry(nullptr), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
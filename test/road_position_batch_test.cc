@@ -0,0 +1,129 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/road_position_batch.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/thread_pool.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class ToRoadPositionsTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumPositions{2000};
+
+  void SetUp() override {
+    road_network_ = CreateDragwayRoadNetwork(DragwayBuildProperties{3, 100., 3.7, 1., 5.});
+    ASSERT_NE(nullptr, road_network_);
+    // Sweeps the road along and across it, including positions off the road.
+    for (int i = 0; i < kNumPositions; ++i) {
+      x_.push_back(-5. + 110. * i / kNumPositions);
+      y_.push_back(-8. + 16. * ((i * 7) % kNumPositions) / kNumPositions);
+      z_.push_back(0.1 * (i % 10));
+    }
+    lane_.resize(kNumPositions, nullptr);
+    s_.resize(kNumPositions);
+    r_.resize(kNumPositions);
+    h_.resize(kNumPositions);
+    distance_.resize(kNumPositions);
+  }
+
+  InertialPositionArrays inertial_positions() const { return {x_.data(), y_.data(), z_.data(), x_.size()}; }
+
+  RoadPositionArrays road_positions() {
+    return {lane_.data(), s_.data(), r_.data(), h_.data(), distance_.data(), lane_.size()};
+  }
+
+  // Checks the results against single position queries.
+  void ExpectMatchesToRoadPosition() const {
+    const api::RoadGeometry* road_geometry = road_network_->road_geometry();
+    for (int i = 0; i < kNumPositions; ++i) {
+      const api::RoadPositionResult expected =
+          road_geometry->ToRoadPosition(api::InertialPosition(x_[i], y_[i], z_[i]));
+      ASSERT_EQ(expected.road_position.lane, lane_[i]) << "at index " << i;
+      EXPECT_DOUBLE_EQ(expected.road_position.pos.s(), s_[i]);
+      EXPECT_DOUBLE_EQ(expected.road_position.pos.r(), r_[i]);
+      EXPECT_DOUBLE_EQ(expected.road_position.pos.h(), h_[i]);
+      EXPECT_DOUBLE_EQ(expected.distance, distance_[i]);
+    }
+  }
+
+  std::unique_ptr<api::RoadNetwork> road_network_;
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<const api::Lane*> lane_;
+  std::vector<double> s_;
+  std::vector<double> r_;
+  std::vector<double> h_;
+  std::vector<double> distance_;
+};
+
+TEST_F(ToRoadPositionsTest, CallingThread) {
+  RoadPositionArrays dut = road_positions();
+  ToRoadPositions(road_network_->road_geometry(), inertial_positions(), &dut);
+  ExpectMatchesToRoadPosition();
+}
+
+TEST_F(ToRoadPositionsTest, ThreadPool) {
+  ThreadPool thread_pool(4);
+  RoadPositionArrays dut = road_positions();
+  ToRoadPositions(road_network_->road_geometry(), inertial_positions(), &dut, &thread_pool);
+  ExpectMatchesToRoadPosition();
+}
+
+TEST_F(ToRoadPositionsTest, Preconditions) {
+  RoadPositionArrays dut = road_positions();
+  EXPECT_THROW(ToRoadPositions(nullptr, inertial_positions(), &dut), maliput::common::assertion_error);
+  EXPECT_THROW(ToRoadPositions(road_network_->road_geometry(), inertial_positions(), nullptr),
+               maliput::common::assertion_error);
+  dut.size = kNumPositions - 1;
+  EXPECT_THROW(ToRoadPositions(road_network_->road_geometry(), inertial_positions(), &dut),
+               maliput::common::assertion_error);
+  dut = road_positions();
+  dut.distance = nullptr;
+  EXPECT_THROW(ToRoadPositions(road_network_->road_geometry(), inertial_positions(), &dut),
+               maliput::common::assertion_error);
+  // Empty inputs are a no-op.
+  EXPECT_NO_THROW(ToRoadPositions(road_network_->road_geometry(), InertialPositionArrays{}, &dut));
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
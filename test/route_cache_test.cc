@@ -0,0 +1,202 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/route_cache.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/junction.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_network.h>
+#include <maliput/api/segment.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::LaneSRange;
+using api::LaneSRoute;
+using api::SRange;
+
+class RouteCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    road_network_ = CreateDragwayRoadNetwork(DragwayBuildProperties{2, 100., 3.7, 0., 5.});
+    lane_0_ = road_network_->road_geometry()->junction(0)->segment(0)->lane(0);
+    lane_1_ = road_network_->road_geometry()->junction(0)->segment(0)->lane(1);
+  }
+
+  // Derives a route from the start lane to the end one, through the end one again, and counts the calls.
+  std::vector<LaneSRoute> Derive(const api::RoadPosition& start, const api::RoadPosition& end, double) {
+    ++num_derivations_;
+    return {LaneSRoute({LaneSRange(start.lane->id(), SRange(start.pos.s(), 100.)),
+                        LaneSRange(end.lane->id(), SRange(0., 100.)),
+                        LaneSRange(end.lane->id(), SRange(0., end.pos.s()))})};
+  }
+
+  RouteCache::Deriver deriver() {
+    return [this](const api::RoadPosition& start, const api::RoadPosition& end, double max_length) {
+      return Derive(start, end, max_length);
+    };
+  }
+
+  api::RoadPosition Position(const api::Lane* lane, double s) const {
+    return api::RoadPosition(lane, api::LanePosition(s, 0., 0.));
+  }
+
+  std::unique_ptr<api::RoadNetwork> road_network_;
+  const api::Lane* lane_0_{};
+  const api::Lane* lane_1_{};
+  int num_derivations_{0};
+};
+
+TEST_F(RouteCacheTest, Constructor) {
+  EXPECT_THROW(RouteCache(0, 1.), common::assertion_error);
+  EXPECT_THROW(RouteCache(1024, 0.), common::assertion_error);
+  const RouteCache dut(1024, 2.);
+  EXPECT_EQ(1024u, dut.memory_budget());
+  EXPECT_EQ(2., dut.s_bucket_size());
+  EXPECT_EQ(0u, dut.statistics().entries);
+}
+
+TEST_F(RouteCacheTest, HitsAreAdjusted) {
+  RouteCache dut(1 << 20, 10.);
+  EXPECT_THROW(dut.GetOrDerive(Position(nullptr, 0.), Position(lane_1_, 0.), 100., deriver()), common::assertion_error);
+  EXPECT_THROW(dut.GetOrDerive(Position(lane_0_, 0.), Position(lane_1_, 0.), 100., nullptr), common::assertion_error);
+
+  dut.GetOrDerive(Position(lane_0_, 21.), Position(lane_1_, 55.), 100., deriver());
+  EXPECT_EQ(1, num_derivations_);
+  // Same buckets.
+  const std::vector<LaneSRoute> routes =
+      dut.GetOrDerive(Position(lane_0_, 29.), Position(lane_1_, 50.), 100., deriver());
+  EXPECT_EQ(1, num_derivations_);
+  ASSERT_EQ(1u, routes.size());
+  ASSERT_EQ(3u, routes[0].ranges().size());
+  EXPECT_EQ(29., routes[0].ranges()[0].s_range().s0());
+  EXPECT_EQ(100., routes[0].ranges()[0].s_range().s1());
+  EXPECT_EQ(0., routes[0].ranges()[1].s_range().s0());
+  EXPECT_EQ(100., routes[0].ranges()[1].s_range().s1());
+  EXPECT_EQ(0., routes[0].ranges()[2].s_range().s0());
+  EXPECT_EQ(50., routes[0].ranges()[2].s_range().s1());
+  // Another start bucket, another maximum length and other lanes.
+  dut.GetOrDerive(Position(lane_0_, 30.), Position(lane_1_, 50.), 100., deriver());
+  dut.GetOrDerive(Position(lane_0_, 29.), Position(lane_1_, 50.), 200., deriver());
+  dut.GetOrDerive(Position(lane_1_, 29.), Position(lane_0_, 50.), 100., deriver());
+  EXPECT_EQ(4, num_derivations_);
+
+  const RouteCache::Statistics statistics = dut.statistics();
+  EXPECT_EQ(1u, statistics.hits);
+  EXPECT_EQ(4u, statistics.misses);
+  EXPECT_EQ(0u, statistics.evictions);
+  EXPECT_EQ(4u, statistics.entries);
+  EXPECT_GT(statistics.memory_usage, 0u);
+}
+
+TEST_F(RouteCacheTest, ShortestRoutesAreSortedAgain) {
+  // Derives the shortest routes leaving the start lane forwards and backwards.
+  const RouteCache::Deriver derive_shortest = [this](const api::RoadPosition& start, const api::RoadPosition& end,
+                                                     double) {
+    ++num_derivations_;
+    std::vector<LaneSRoute> routes{LaneSRoute({LaneSRange(start.lane->id(), SRange(start.pos.s(), 100.)),
+                                               LaneSRange(end.lane->id(), SRange(0., end.pos.s()))}),
+                                   LaneSRoute({LaneSRange(start.lane->id(), SRange(start.pos.s(), 0.)),
+                                               LaneSRange(end.lane->id(), SRange(0., end.pos.s()))})};
+    if (start.pos.s() < 50.) {
+      std::swap(routes[0], routes[1]);
+    }
+    return routes;
+  };
+  RouteCache dut(1 << 20, 100.);
+  EXPECT_THROW(dut.GetOrDerive(Position(lane_0_, 0.), Position(lane_1_, 0.), 100., derive_shortest, 0),
+               common::assertion_error);
+
+  std::vector<LaneSRoute> routes =
+      dut.GetOrDerive(Position(lane_0_, 20.), Position(lane_1_, 10.), 100., derive_shortest, 2);
+  ASSERT_EQ(2u, routes.size());
+  EXPECT_EQ(0., routes[0].ranges()[0].s_range().s1());
+  // Same buckets, but the route leaving forwards is the shortest one now.
+  routes = dut.GetOrDerive(Position(lane_0_, 80.), Position(lane_1_, 10.), 100., derive_shortest, 2);
+  EXPECT_EQ(1, num_derivations_);
+  ASSERT_EQ(2u, routes.size());
+  EXPECT_EQ(80., routes[0].ranges()[0].s_range().s0());
+  EXPECT_EQ(100., routes[0].ranges()[0].s_range().s1());
+  EXPECT_EQ(80., routes[1].ranges()[0].s_range().s0());
+  EXPECT_EQ(0., routes[1].ranges()[0].s_range().s1());
+
+  // Routes derived another way are stored apart.
+  dut.GetOrDerive(Position(lane_0_, 80.), Position(lane_1_, 10.), 100., derive_shortest, 1);
+  dut.GetOrDerive(Position(lane_0_, 80.), Position(lane_1_, 10.), 100., deriver());
+  EXPECT_EQ(3, num_derivations_);
+  EXPECT_EQ(3u, dut.statistics().entries);
+}
+
+TEST_F(RouteCacheTest, EvictsLeastRecentlyUsed) {
+  // Measures the memory usage of an entry, all of them being alike.
+  RouteCache probe(1 << 20, 10.);
+  probe.GetOrDerive(Position(lane_0_, 0.), Position(lane_1_, 0.), 100., deriver());
+  const std::size_t entry_memory_usage = probe.statistics().memory_usage;
+
+  // Fits two entries.
+  RouteCache dut(2 * entry_memory_usage + entry_memory_usage / 2, 10.);
+  dut.GetOrDerive(Position(lane_0_, 0.), Position(lane_1_, 0.), 100., deriver());
+  dut.GetOrDerive(Position(lane_0_, 10.), Position(lane_1_, 0.), 100., deriver());
+  // Makes the first entry the most recently used one, so the second one is evicted next.
+  dut.GetOrDerive(Position(lane_0_, 0.), Position(lane_1_, 0.), 100., deriver());
+  dut.GetOrDerive(Position(lane_0_, 20.), Position(lane_1_, 0.), 100., deriver());
+  RouteCache::Statistics statistics = dut.statistics();
+  EXPECT_EQ(1u, statistics.evictions);
+  EXPECT_EQ(2u, statistics.entries);
+  EXPECT_LE(statistics.memory_usage, dut.memory_budget());
+
+  num_derivations_ = 0;
+  dut.GetOrDerive(Position(lane_0_, 0.), Position(lane_1_, 0.), 100., deriver());
+  EXPECT_EQ(0, num_derivations_);
+  dut.GetOrDerive(Position(lane_0_, 10.), Position(lane_1_, 0.), 100., deriver());
+  EXPECT_EQ(1, num_derivations_);
+
+  // Entries over the budget are not stored.
+  RouteCache tiny(1, 10.);
+  tiny.GetOrDerive(Position(lane_0_, 0.), Position(lane_1_, 0.), 100., deriver());
+  statistics = tiny.statistics();
+  EXPECT_EQ(0u, statistics.entries);
+  EXPECT_EQ(0u, statistics.memory_usage);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
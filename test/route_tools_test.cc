@@ -0,0 +1,221 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/route_tools.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/regions.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/lane_graph.h"
+#include "integration/route_cache.h"
+#include "integration/synthetic_road_network.h"
+#include "integration/thread_pool.h"
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+using api::LaneId;
+using api::LaneSRange;
+using api::LaneSRoute;
+using api::SRange;
+
+GTEST_TEST(StitchLaneSRoutesTest, MergesContinuousRanges) {
+  const LaneSRoute first({LaneSRange(LaneId("a"), SRange(2., 10.)), LaneSRange(LaneId("b"), SRange(0., 4.))});
+  const LaneSRoute second({LaneSRange(LaneId("b"), SRange(4., 8.)), LaneSRange(LaneId("c"), SRange(0., 1.))});
+  const LaneSRoute dut = StitchLaneSRoutes(first, second);
+  ASSERT_EQ(3u, dut.ranges().size());
+  EXPECT_EQ(LaneId("b"), dut.ranges()[1].lane_id());
+  EXPECT_DOUBLE_EQ(0., dut.ranges()[1].s_range().s0());
+  EXPECT_DOUBLE_EQ(8., dut.ranges()[1].s_range().s1());
+  EXPECT_EQ(LaneId("c"), dut.ranges()[2].lane_id());
+}
+
+GTEST_TEST(StitchLaneSRoutesTest, KeepsDiscontinuousRanges) {
+  const LaneSRoute first({LaneSRange(LaneId("a"), SRange(2., 10.))});
+  // Goes backwards along the same lane.
+  EXPECT_EQ(2u, StitchLaneSRoutes(first, LaneSRoute({LaneSRange(LaneId("a"), SRange(10., 5.))})).ranges().size());
+  // Starts elsewhere on the same lane.
+  EXPECT_EQ(2u, StitchLaneSRoutes(first, LaneSRoute({LaneSRange(LaneId("a"), SRange(11., 12.))})).ranges().size());
+  // Another lane.
+  EXPECT_EQ(2u, StitchLaneSRoutes(first, LaneSRoute({LaneSRange(LaneId("b"), SRange(10., 12.))})).ranges().size());
+}
+
+GTEST_TEST(DeriveMultiWaypointLaneSRoutesTest, SingleLane) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateDragwayRoadNetwork(DragwayBuildProperties{1, 100., 3.7, 0., 5.});
+  const std::vector<api::RoadPosition> waypoints =
+      LocalizeWaypoints(road_network->road_geometry(), {api::InertialPosition(10., 0., 0.),
+                                                        api::InertialPosition(30., 0., 0.),
+                                                        api::InertialPosition(60., 0., 0.)});
+  ASSERT_EQ(3u, waypoints.size());
+  const std::vector<LaneSRoute> routes = DeriveMultiWaypointLaneSRoutes(waypoints, 1000., 10);
+  ASSERT_EQ(1u, routes.size());
+  ASSERT_EQ(1u, routes[0].ranges().size());
+  EXPECT_NEAR(10., routes[0].ranges()[0].s_range().s0(), 1e-6);
+  EXPECT_NEAR(60., routes[0].ranges()[0].s_range().s1(), 1e-6);
+
+  // Legs are looked up in the cache, and adjusted to the waypoints. All of them share the same lane and buckets, so
+  // only the first leg is derived.
+  RouteCache route_cache(1 << 20, 100.);
+  DeriveMultiWaypointLaneSRoutes(waypoints, 1000., 10, nullptr, &route_cache);
+  const std::vector<LaneSRoute> cached_routes =
+      DeriveMultiWaypointLaneSRoutes({waypoints[0], waypoints[2]}, 1000., 10, nullptr, &route_cache);
+  EXPECT_EQ(1u, route_cache.statistics().misses);
+  EXPECT_EQ(2u, route_cache.statistics().hits);
+  ASSERT_EQ(1u, cached_routes.size());
+  ASSERT_EQ(1u, cached_routes[0].ranges().size());
+  EXPECT_NEAR(10., cached_routes[0].ranges()[0].s_range().s0(), 1e-6);
+  EXPECT_NEAR(60., cached_routes[0].ranges()[0].s_range().s1(), 1e-6);
+
+  EXPECT_THROW(DeriveMultiWaypointLaneSRoutes({waypoints[0]}, 1000., 10), common::assertion_error);
+  EXPECT_THROW(DeriveMultiWaypointLaneSRoutes(waypoints, 1000., 0), common::assertion_error);
+  EXPECT_THROW(LocalizeWaypoints(nullptr, {}), common::assertion_error);
+}
+
+GTEST_TEST(DeriveMultiWaypointLaneSRoutesTest, ThroughIntersection) {
+  // A chain of three intersections, joined by one-way single lane roads along the x axis.
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{1, 3, 1, 3.7, 100., false, false});
+  const std::vector<api::RoadPosition> waypoints =
+      LocalizeWaypoints(road_network->road_geometry(), {api::InertialPosition(20., 0., 0.),
+                                                        api::InertialPosition(100., 0., 0.),
+                                                        api::InertialPosition(150., 0., 0.)});
+  const std::vector<LaneSRoute> routes = DeriveMultiWaypointLaneSRoutes(waypoints, 1000., 10);
+  ASSERT_EQ(1u, routes.size());
+  // The ranges of both legs on the intersection lane are merged.
+  ASSERT_EQ(3u, routes[0].ranges().size());
+  EXPECT_EQ(LaneId("l:r0_0_1_0_f_0"), routes[0].ranges()[0].lane_id());
+  EXPECT_EQ(LaneId("l:i1_0_we_0"), routes[0].ranges()[1].lane_id());
+  EXPECT_EQ(LaneId("l:r1_0_2_0_f_0"), routes[0].ranges()[2].lane_id());
+
+  // Legs derived on a LaneGraph yield the same routes.
+  const LaneGraph lane_graph(road_network->road_geometry());
+  const std::vector<LaneSRoute> graph_routes = DeriveMultiWaypointLaneSRoutes(waypoints, 1000., 10, &lane_graph);
+  ASSERT_EQ(1u, graph_routes.size());
+  ASSERT_EQ(3u, graph_routes[0].ranges().size());
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(routes[0].ranges()[i].lane_id(), graph_routes[0].ranges()[i].lane_id());
+    EXPECT_NEAR(routes[0].ranges()[i].s_range().s0(), graph_routes[0].ranges()[i].s_range().s0(), 1e-9);
+    EXPECT_NEAR(routes[0].ranges()[i].s_range().s1(), graph_routes[0].ranges()[i].s_range().s1(), 1e-9);
+  }
+}
+
+GTEST_TEST(GetLaneSRouteLengthTest, SumsRanges) {
+  EXPECT_DOUBLE_EQ(0., GetLaneSRouteLength(LaneSRoute(std::vector<LaneSRange>{})));
+  EXPECT_DOUBLE_EQ(14., GetLaneSRouteLength(LaneSRoute(
+                            {LaneSRange(LaneId("a"), SRange(2., 10.)), LaneSRange(LaneId("b"), SRange(6., 0.))})));
+}
+
+GTEST_TEST(DeriveShortestMultiWaypointLaneSRoutesTest, RanksCombinations) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{3, 3, 1, 3.7, 60., true, true});
+  const LaneGraph lane_graph(road_network->road_geometry());
+  // Eastbound along the south row, then eastbound along the north row and northbound along the east column.
+  const std::vector<api::RoadPosition> waypoints =
+      LocalizeWaypoints(road_network->road_geometry(), {api::InertialPosition(30., -1.85, 0.),
+                                                        api::InertialPosition(90., 118.15, 0.),
+                                                        api::InertialPosition(121.85, 90., 0.)});
+  constexpr double kMaxLength{400.};
+  std::vector<double> lengths;
+  for (const LaneSRoute& route : DeriveMultiWaypointLaneSRoutes(waypoints, kMaxLength, 100000, &lane_graph)) {
+    lengths.push_back(GetLaneSRouteLength(route));
+  }
+  ASSERT_GE(lengths.size(), 3u);
+  std::sort(lengths.begin(), lengths.end());
+  const std::vector<LaneSRoute> routes = DeriveShortestMultiWaypointLaneSRoutes(waypoints, kMaxLength, 3, &lane_graph);
+  ASSERT_EQ(3u, routes.size());
+  for (std::size_t i = 0; i < routes.size(); ++i) {
+    EXPECT_NEAR(lengths[i], GetLaneSRouteLength(routes[i]), 1e-9);
+  }
+
+  EXPECT_THROW(DeriveShortestMultiWaypointLaneSRoutes(waypoints, kMaxLength, 3, nullptr), common::assertion_error);
+  EXPECT_THROW(DeriveShortestMultiWaypointLaneSRoutes(waypoints, kMaxLength, 0, &lane_graph), common::assertion_error);
+  EXPECT_THROW(RunRouteJob(road_network->road_geometry(), RouteJob{}, 3, nullptr, RoutingMode::kShortest),
+               common::assertion_error);
+}
+
+GTEST_TEST(RunRouteJobTest, ReportsErrors) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateDragwayRoadNetwork(DragwayBuildProperties{1, 100., 3.7, 0., 5.});
+  const RouteJobResult result =
+      RunRouteJob(road_network->road_geometry(), RouteJob{{api::InertialPosition(10., 0., 0.)}, 100.}, 10);
+  EXPECT_FALSE(result.error.empty());
+  EXPECT_TRUE(result.routes.empty());
+  EXPECT_THROW(RunRouteJob(nullptr, RouteJob{}, 10), common::assertion_error);
+}
+
+class RunRouteJobsTest : public ::testing::TestWithParam<int> {};
+
+TEST_P(RunRouteJobsTest, ResultsAreInJobOrder) {
+  constexpr std::size_t kNumJobs{50};
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateDragwayRoadNetwork(DragwayBuildProperties{1, 100., 3.7, 0., 5.});
+  std::size_t next_index{0};
+  const auto next_job = [&next_index]() -> std::optional<RouteJob> {
+    if (next_index == kNumJobs) {
+      return std::nullopt;
+    }
+    const double s = static_cast<double>(next_index++);
+    return RouteJob{{api::InertialPosition(s, 0., 0.), api::InertialPosition(s + 10., 0., 0.)}, 100.};
+  };
+  std::vector<double> start_s;
+  const auto on_result = [&start_s](std::size_t index, const RouteJob& job, const RouteJobResult& result) {
+    EXPECT_EQ(start_s.size(), index);
+    EXPECT_DOUBLE_EQ(static_cast<double>(index), job.waypoints.front().x());
+    EXPECT_TRUE(result.error.empty());
+    ASSERT_EQ(1u, result.routes.size());
+    start_s.push_back(result.routes[0].ranges()[0].s_range().s0());
+  };
+  std::unique_ptr<ThreadPool> thread_pool = GetParam() > 0 ? std::make_unique<ThreadPool>(GetParam()) : nullptr;
+
+  EXPECT_EQ(kNumJobs, RunRouteJobs(road_network->road_geometry(), next_job, 10, 3, thread_pool.get(), on_result));
+  ASSERT_EQ(kNumJobs, start_s.size());
+  for (std::size_t i = 0; i < kNumJobs; ++i) {
+    EXPECT_NEAR(static_cast<double>(i), start_s[i], 1e-6);
+  }
+  EXPECT_THROW(RunRouteJobs(road_network->road_geometry(), next_job, 10, 0, thread_pool.get(), on_result),
+               common::assertion_error);
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, RunRouteJobsTest, ::testing::Values(0, 1, 4));
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
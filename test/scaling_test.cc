@@ -0,0 +1,83 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/scaling.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+static constexpr double kTolerance{1e-9};
+
+GTEST_TEST(ComputeScalingReportTest, SpeedupAndEfficiency) {
+  const ScalingReport dut = ComputeScalingReport(8., {4, 1, 2}, {2.5, 8., 4.});
+  EXPECT_NEAR(8., dut.baseline_time, kTolerance);
+  ASSERT_EQ(3u, dut.points.size());
+  // Points are sorted by number of threads.
+  EXPECT_EQ(1, dut.points[0].num_threads);
+  EXPECT_EQ(2, dut.points[1].num_threads);
+  EXPECT_EQ(4, dut.points[2].num_threads);
+  EXPECT_NEAR(1., dut.points[0].speedup, kTolerance);
+  EXPECT_NEAR(2., dut.points[1].speedup, kTolerance);
+  EXPECT_NEAR(3.2, dut.points[2].speedup, kTolerance);
+  EXPECT_NEAR(1., dut.points[0].efficiency, kTolerance);
+  EXPECT_NEAR(1., dut.points[1].efficiency, kTolerance);
+  EXPECT_NEAR(0.8, dut.points[2].efficiency, kTolerance);
+}
+
+GTEST_TEST(ComputeScalingReportTest, KneeOfSaturatingCurve) {
+  // Speedup grows linearly up to 4 threads and is flat afterwards.
+  const std::vector<int> kNumThreads{1, 2, 3, 4, 5, 6, 7, 8};
+  const std::vector<double> kTimes{8., 4., 8. / 3., 2., 2., 2., 2., 2.};
+  const ScalingReport dut = ComputeScalingReport(8., kNumThreads, kTimes);
+  EXPECT_EQ(4, dut.points[dut.knee_index].num_threads);
+}
+
+GTEST_TEST(ComputeScalingReportTest, KneeOfFlatCurve) {
+  const ScalingReport dut = ComputeScalingReport(1., {1, 2, 4}, {1., 1., 1.});
+  EXPECT_EQ(0, dut.knee_index);
+}
+
+GTEST_TEST(ComputeScalingReportTest, Throws) {
+  EXPECT_THROW(ComputeScalingReport(0., {1}, {1.}), maliput::common::assertion_error);
+  EXPECT_THROW(ComputeScalingReport(1., {}, {}), maliput::common::assertion_error);
+  EXPECT_THROW(ComputeScalingReport(1., {1, 2}, {1.}), maliput::common::assertion_error);
+  EXPECT_THROW(ComputeScalingReport(1., {0}, {1.}), maliput::common::assertion_error);
+  EXPECT_THROW(ComputeScalingReport(1., {1}, {0.}), maliput::common::assertion_error);
+  EXPECT_THROW(ComputeScalingReport(1., {2, 2}, {1., 1.}), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,101 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/statistics.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+static constexpr double kTolerance{1e-9};
+
+GTEST_TEST(PercentileTest, InterpolatesBetweenClosestRanks) {
+  const std::vector<double> kSamples{4., 1., 3., 2., 5.};
+  EXPECT_NEAR(1., Percentile(kSamples, 0.), kTolerance);
+  EXPECT_NEAR(3., Percentile(kSamples, 50.), kTolerance);
+  EXPECT_NEAR(4.6, Percentile(kSamples, 90.), kTolerance);
+  EXPECT_NEAR(5., Percentile(kSamples, 100.), kTolerance);
+}
+
+GTEST_TEST(PercentileTest, Throws) {
+  EXPECT_THROW(Percentile({}, 50.), maliput::common::assertion_error);
+  EXPECT_THROW(Percentile({1.}, -1.), maliput::common::assertion_error);
+  EXPECT_THROW(Percentile({1.}, 101.), maliput::common::assertion_error);
+}
+
+GTEST_TEST(ComputeSampleStatisticsTest, SingleSample) {
+  const SampleStatistics dut = ComputeSampleStatistics({2.5});
+  EXPECT_EQ(1, dut.count);
+  EXPECT_NEAR(2.5, dut.min, kTolerance);
+  EXPECT_NEAR(2.5, dut.max, kTolerance);
+  EXPECT_NEAR(2.5, dut.mean, kTolerance);
+  EXPECT_NEAR(2.5, dut.median, kTolerance);
+  EXPECT_NEAR(2.5, dut.p99, kTolerance);
+  EXPECT_NEAR(0., dut.stddev, kTolerance);
+  EXPECT_NEAR(2.5, dut.ci95_low, kTolerance);
+  EXPECT_NEAR(2.5, dut.ci95_high, kTolerance);
+}
+
+GTEST_TEST(ComputeSampleStatisticsTest, MultipleSamples) {
+  const std::vector<double> kSamples{2., 4., 4., 4., 5., 5., 7., 9.};
+  const SampleStatistics dut = ComputeSampleStatistics(kSamples);
+  EXPECT_EQ(8, dut.count);
+  EXPECT_NEAR(2., dut.min, kTolerance);
+  EXPECT_NEAR(9., dut.max, kTolerance);
+  EXPECT_NEAR(5., dut.mean, kTolerance);
+  EXPECT_NEAR(4.5, dut.median, kTolerance);
+  EXPECT_NEAR(7.6, dut.p90, kTolerance);
+  EXPECT_NEAR(8.86, dut.p99, kTolerance);
+  // Sample standard deviation: sqrt(32 / 7).
+  EXPECT_NEAR(2.138089935, dut.stddev, 1e-9);
+  // Student's t for 7 degrees of freedom is 2.365.
+  const double kHalfWidth = 2.365 * 2.138089935 / std::sqrt(8.);
+  EXPECT_NEAR(5. - kHalfWidth, dut.ci95_low, 1e-6);
+  EXPECT_NEAR(5. + kHalfWidth, dut.ci95_high, 1e-6);
+}
+
+GTEST_TEST(ComputeSampleStatisticsTest, OutlierDoesNotMoveMedian) {
+  const SampleStatistics dut = ComputeSampleStatistics({1., 1., 1., 1., 100.});
+  EXPECT_NEAR(1., dut.median, kTolerance);
+  EXPECT_NEAR(20.8, dut.mean, kTolerance);
+}
+
+GTEST_TEST(ComputeSampleStatisticsTest, Throws) {
+  EXPECT_THROW(ComputeSampleStatistics({}), maliput::common::assertion_error);
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
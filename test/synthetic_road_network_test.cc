@@ -0,0 +1,105 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/synthetic_road_network.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <maliput/api/branch_point.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/road_geometry.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+#include <yaml-cpp/yaml.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+YAML::Node LoadBuilder(const SyntheticRoadNetworkProperties& properties) {
+  const YAML::Node root = YAML::Load(GenerateSyntheticMultilaneYaml(properties));
+  return root["maliput_multilane_builder"];
+}
+
+GTEST_TEST(GenerateSyntheticMultilaneYamlTest, TwoWayGridWithTurns) {
+  const YAML::Node builder = LoadBuilder(SyntheticRoadNetworkProperties{3, 3, 2, 3.7, 100., true, true});
+  ASSERT_TRUE(builder.IsMap());
+  // 12 roads in both directions, plus every connection from a road into the others at each intersection: 4 corners
+  // with 2 roads, 4 sides with 3 and the center with 4.
+  EXPECT_EQ(24u + 4u * 2u + 4u * 6u + 12u, builder["connections"].size());
+  EXPECT_EQ(builder["connections"].size(), builder["points"].size());
+  // A group per road and per intersection.
+  EXPECT_EQ(12u + 9u, builder["groups"].size());
+
+  const YAML::Node road = builder["connections"]["r0_1_1_1_f"];
+  ASSERT_TRUE(road.IsMap());
+  EXPECT_EQ(2, road["lanes"][0].as<int>());
+  // The blocks lose the intersection inset, i.e. 3 lane widths, at both ends.
+  EXPECT_DOUBLE_EQ(100. - 2. * 3. * 3.7, road["length"].as<double>());
+  EXPECT_TRUE(builder["connections"]["i1_1_wn"]["arc"].IsSequence());
+  EXPECT_TRUE(builder["connections"]["i1_1_ws"]["arc"].IsSequence());
+  EXPECT_FALSE(builder["connections"]["i1_1_ww"].IsDefined());
+}
+
+GTEST_TEST(GenerateSyntheticMultilaneYamlTest, OneWayChainWithoutTurns) {
+  const YAML::Node builder = LoadBuilder(SyntheticRoadNetworkProperties{1, 4, 3, 3.5, 50., false, false});
+  // 3 eastbound roads and a straight connection at each of the 2 inner intersections.
+  EXPECT_EQ(3u + 2u, builder["connections"].size());
+  EXPECT_EQ(3u + 2u, builder["groups"].size());
+  EXPECT_TRUE(builder["connections"]["i1_0_we"].IsMap());
+  EXPECT_FALSE(builder["connections"]["r0_0_1_0_b"].IsDefined());
+}
+
+GTEST_TEST(GenerateSyntheticMultilaneYamlTest, InvalidProperties) {
+  EXPECT_THROW(GenerateSyntheticMultilaneYaml(SyntheticRoadNetworkProperties{0, 3}), common::assertion_error);
+  EXPECT_THROW(GenerateSyntheticMultilaneYaml(SyntheticRoadNetworkProperties{1, 1}), common::assertion_error);
+  EXPECT_THROW(GenerateSyntheticMultilaneYaml(SyntheticRoadNetworkProperties{2, 2, 0}), common::assertion_error);
+  // Intersections would overlap.
+  EXPECT_THROW(GenerateSyntheticMultilaneYaml(SyntheticRoadNetworkProperties{2, 2, 4, 3.7, 20.}),
+               common::assertion_error);
+}
+
+GTEST_TEST(CreateSyntheticRoadNetworkTest, ConnectsBlocksThroughIntersections) {
+  const std::unique_ptr<api::RoadNetwork> road_network =
+      CreateSyntheticRoadNetwork(SyntheticRoadNetworkProperties{3, 3, 2, 3.7, 100., true, true});
+  ASSERT_NE(nullptr, road_network);
+  const api::RoadGeometry* road_geometry = road_network->road_geometry();
+  EXPECT_EQ(12 + 9, road_geometry->num_junctions());
+
+  // The eastbound lanes arriving at the center intersection go straight, left and right.
+  const api::Lane* lane = road_geometry->ById().GetLane(api::LaneId("l:r0_1_1_1_f_0"));
+  ASSERT_NE(nullptr, lane);
+  EXPECT_EQ(3, lane->GetOngoingBranches(api::LaneEnd::kFinish)->size());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -0,0 +1,82 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/thread_pool.h"
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
+
+namespace maliput {
+namespace integration {
+namespace {
+
+GTEST_TEST(ThreadPoolTest, Constructor) {
+  EXPECT_THROW(ThreadPool(-1), maliput::common::assertion_error);
+  EXPECT_EQ(3, ThreadPool(3).num_threads());
+  EXPECT_GE(ThreadPool(0).num_threads(), 1);
+}
+
+GTEST_TEST(ThreadPoolTest, Results) {
+  ThreadPool dut(4);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(dut.Submit([i]() { return i * i; }));
+  }
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(i * i, results[i].get());
+  }
+}
+
+GTEST_TEST(ThreadPoolTest, Exceptions) {
+  ThreadPool dut(2);
+  std::future<void> result = dut.Submit([]() { throw std::runtime_error("error"); });
+  EXPECT_THROW(result.get(), std::runtime_error);
+  // The pool keeps working after a task throws.
+  EXPECT_EQ(1, dut.Submit([]() { return 1; }).get());
+}
+
+GTEST_TEST(ThreadPoolTest, DestructorRunsPendingTasks) {
+  std::atomic<int> counter{0};
+  {
+    ThreadPool dut(1);
+    for (int i = 0; i < 10; ++i) {
+      dut.Submit([&counter]() { ++counter; });
+    }
+  }
+  EXPECT_EQ(10, counter.load());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput
@@ -30,12 +30,24 @@
 #include "integration/tools.h"
 
 #include <stdlib.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
+#include <maliput/common/assertion_error.h>
 #include <maliput_dragway/road_geometry.h>
 #include <maliput_multilane/builder.h>
 #include <maliput_multilane/loader.h>
 
+#include "integration/phase_profiler.h"
+#include "integration/thread_pool.h"
+
 namespace maliput {
 namespace integration {
 namespace {
@@ -53,6 +65,18 @@ TEST_F(CreateMalidriveRoadNetworkTest, MalidriveRoadNetwork) {
   // EXPECT_NE(nullptr, dynamic_cast<const malidrive::RoadGeometry*>(dut->road_geometry()));
 }
 
+TEST_F(CreateMalidriveRoadNetworkTest, GeometryOnlySkipsBooks) {
+  MalidriveBuildProperties build_properties{"TShapeRoad.xodr"};
+  build_properties.traffic_light_book_file = "TShapeRoad.yaml";
+  const std::unique_ptr<const api::RoadNetwork> with_books = CreateMalidriveRoadNetwork(build_properties);
+  EXPECT_FALSE(with_books->traffic_light_book()->TrafficLights().empty());
+
+  build_properties.geometry_only = true;
+  const std::unique_ptr<const api::RoadNetwork> geometry_only = CreateMalidriveRoadNetwork(build_properties);
+  EXPECT_NE(nullptr, geometry_only->road_geometry());
+  EXPECT_TRUE(geometry_only->traffic_light_book()->TrafficLights().empty());
+}
+
 class CreateMultilaneRoadNetworkTest : public ::testing::Test {};
 
 TEST_F(CreateMultilaneRoadNetworkTest, MultilaneRoadNetwork) {
@@ -79,6 +103,105 @@ GTEST_TEST(CreateRoadNetwork, DragwayRoadNetwork) {
   EXPECT_NE(nullptr, dynamic_cast<const dragway::RoadGeometry*>(dut->road_geometry()));
 }
 
+GTEST_TEST(CreateRoadNetwork, DragwayRoadNetworkPhases) {
+  PhaseProfiler profiler;
+  std::unique_ptr<const api::RoadNetwork> dut =
+      LoadRoadNetwork(MaliputImplementation::kDragway, DragwayBuildProperties{}, {}, {}, {}, &profiler);
+  EXPECT_NE(nullptr, dut);
+  ASSERT_EQ(1u, profiler.phases().size());
+  const PhaseProfiler::Phase& load_phase = profiler.phases().front();
+  EXPECT_EQ("load_road_network", load_phase.name);
+  ASSERT_EQ(3u, load_phase.children.size());
+  EXPECT_EQ("road_geometry", load_phase.children[0].name);
+  EXPECT_EQ("books", load_phase.children[1].name);
+  EXPECT_EQ("road_network_assembly", load_phase.children[2].name);
+}
+
+GTEST_TEST(LoadRoadNetworks, ConcurrentBuildsAndErrors) {
+  std::vector<RoadNetworkDescriptor> descriptors(4);
+  for (int i = 0; i < 3; ++i) {
+    descriptors[i].maliput_implementation = MaliputImplementation::kDragway;
+    descriptors[i].dragway_build_properties.num_lanes = i + 1;
+  }
+  // An empty yaml file path makes the multilane build fail.
+  descriptors[3].maliput_implementation = MaliputImplementation::kMultilane;
+
+  const std::vector<RoadNetworkLoadResult> dut = LoadRoadNetworks(descriptors, 2);
+  ASSERT_EQ(4u, dut.size());
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_NE(nullptr, dut[i].road_network);
+    EXPECT_TRUE(dut[i].error.empty());
+    EXPECT_EQ(i + 1, dut[i].road_network->road_geometry()->junction(0)->segment(0)->num_lanes());
+  }
+  EXPECT_EQ(nullptr, dut[3].road_network);
+  EXPECT_FALSE(dut[3].error.empty());
+
+  EXPECT_TRUE(LoadRoadNetworks({}).empty());
+  EXPECT_THROW(LoadRoadNetworks(descriptors, -1), maliput::common::assertion_error);
+}
+
+GTEST_TEST(LoadRoadNetworksAsync, Futures) {
+  ThreadPool thread_pool(2);
+  std::vector<std::future<std::unique_ptr<api::RoadNetwork>>> dut =
+      LoadRoadNetworksAsync({RoadNetworkDescriptor{}, RoadNetworkDescriptor{}}, &thread_pool);
+  ASSERT_EQ(2u, dut.size());
+  for (auto& road_network : dut) {
+    EXPECT_NE(nullptr, road_network.get());
+  }
+  EXPECT_THROW(LoadRoadNetworksAsync({}, nullptr), maliput::common::assertion_error);
+}
+
+// Sets an environment variable for the lifetime of the object and restores its previous value afterwards.
+class ScopedEnv {
+ public:
+  ScopedEnv(const std::string& name, const std::string& value) : name_(name) {
+    const char* previous_value = getenv(name.c_str());
+    if (previous_value != nullptr) {
+      previous_value_ = previous_value;
+    }
+    setenv(name_.c_str(), value.c_str(), 1);
+  }
+
+  ~ScopedEnv() {
+    if (previous_value_.has_value()) {
+      setenv(name_.c_str(), previous_value_->c_str(), 1);
+    } else {
+      unsetenv(name_.c_str());
+    }
+  }
+
+ private:
+  const std::string name_;
+  std::optional<std::string> previous_value_;
+};
+
+GTEST_TEST(GetResourceTest, SearchRootsAndCache) {
+  static constexpr char kFileName[] = "get_resource_test.yaml";
+  char temp_dir_template[] = "/tmp/get_resource_test_XXXXXX";
+  const std::string temp_dir = mkdtemp(temp_dir_template);
+  const std::string file_path = temp_dir + "/" + kFileName;
+  std::ofstream(file_path) << "content";
+
+  {
+    const ScopedEnv env("MULTILANE_RESOURCE_ROOT", "/non_existent_directory:" + temp_dir);
+    ClearResourceCache();
+    // The file is found at the second search root.
+    EXPECT_EQ(file_path, GetResource(MaliputImplementation::kMultilane, kFileName));
+    // Absolute paths are returned as they are.
+    EXPECT_EQ(file_path, GetResource(MaliputImplementation::kMultilane, file_path));
+    // Missing resources are returned as they are.
+    EXPECT_EQ("missing.yaml", GetResource(MaliputImplementation::kMultilane, "missing.yaml"));
+
+    // The resolved path is cached until the cache is cleared.
+    std::remove(file_path.c_str());
+    EXPECT_EQ(file_path, GetResource(MaliputImplementation::kMultilane, kFileName));
+    ClearResourceCache();
+    EXPECT_EQ(kFileName, GetResource(MaliputImplementation::kMultilane, kFileName));
+  }
+  rmdir(temp_dir.c_str());
+  ClearResourceCache();
+}
+
 class CreateMaliputOsmRoadNetworkTest : public ::testing::Test {};
 
 TEST_F(CreateMaliputOsmRoadNetworkTest, MaliputOsmRoadNetwork) {
@@ -0,0 +1,121 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2022, Woven Planet. All rights reserved.
+// Copyright (c) 2022, Toyota Research Institute. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "integration/trajectory_localizer.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <maliput/api/lane.h>
+#include <maliput/api/lane_data.h>
+#include <maliput/api/road_network.h>
+#include <maliput/common/assertion_error.h>
+
+#include "integration/tools.h"
+
+namespace maliput {
+namespace integration {
+namespace {
+
+class TrajectoryLocalizerTest : public ::testing::Test {
+ protected:
+  static constexpr double kLength{100.};
+  static constexpr double kDistanceThreshold{1e-3};
+
+  void SetUp() override {
+    road_network_ = CreateDragwayRoadNetwork(DragwayBuildProperties{3, kLength, 3.7, 1., 5.});
+    ASSERT_NE(nullptr, road_network_);
+    road_geometry_ = road_network_->road_geometry();
+    right_lane_ = road_geometry_->junction(0)->segment(0)->lane(0);
+    left_lane_ = right_lane_->to_left();
+    ASSERT_NE(nullptr, left_lane_);
+  }
+
+  // Localizes the position at @p s and @p r of @p lane with @p dut and checks the result against the global query.
+  void ExpectLocalizes(const api::Lane* lane, double s, double r, TrajectoryLocalizer* dut) const {
+    const api::InertialPosition inertial_position = lane->ToInertialPosition(api::LanePosition(s, r, 0.));
+    const api::RoadPositionResult expected = road_geometry_->ToRoadPosition(inertial_position);
+    const api::RoadPositionResult result = dut->Localize(inertial_position);
+    ASSERT_EQ(expected.road_position.lane, result.road_position.lane);
+    EXPECT_NEAR(expected.road_position.pos.s(), result.road_position.pos.s(), kDistanceThreshold);
+    EXPECT_NEAR(expected.road_position.pos.r(), result.road_position.pos.r(), kDistanceThreshold);
+    EXPECT_NEAR(expected.distance, result.distance, kDistanceThreshold);
+  }
+
+  std::unique_ptr<api::RoadNetwork> road_network_;
+  const api::RoadGeometry* road_geometry_{};
+  const api::Lane* right_lane_{};
+  const api::Lane* left_lane_{};
+};
+
+TEST_F(TrajectoryLocalizerTest, Preconditions) {
+  EXPECT_THROW(TrajectoryLocalizer(nullptr, kDistanceThreshold), maliput::common::assertion_error);
+  EXPECT_THROW(TrajectoryLocalizer(road_geometry_, -1.), maliput::common::assertion_error);
+}
+
+TEST_F(TrajectoryLocalizerTest, FollowsLane) {
+  TrajectoryLocalizer dut(road_geometry_, kDistanceThreshold);
+  for (double s = 1.; s < kLength; s += 1.) {
+    ExpectLocalizes(right_lane_, s, 0.2, &dut);
+  }
+  // Only the first sample needs the global query.
+  EXPECT_EQ(1, dut.num_fallbacks());
+  EXPECT_EQ(98, dut.num_hint_hits());
+}
+
+TEST_F(TrajectoryLocalizerTest, ChangesLane) {
+  TrajectoryLocalizer dut(road_geometry_, kDistanceThreshold);
+  ExpectLocalizes(right_lane_, 10., 0., &dut);
+  ExpectLocalizes(right_lane_, 11., 1., &dut);
+  ExpectLocalizes(left_lane_, 12., -1., &dut);
+  ExpectLocalizes(left_lane_, 13., 0., &dut);
+  EXPECT_EQ(1, dut.num_fallbacks());
+  EXPECT_EQ(3, dut.num_hint_hits());
+}
+
+TEST_F(TrajectoryLocalizerTest, FallsBackAndResets) {
+  TrajectoryLocalizer dut(road_geometry_, kDistanceThreshold);
+  ExpectLocalizes(right_lane_, 10., 0., &dut);
+  // The sample is off the road, beyond the distance threshold of every hinted lane.
+  const api::InertialPosition off_road = right_lane_->ToInertialPosition(api::LanePosition(kLength + 10., 0., 0.));
+  const api::RoadPositionResult expected = road_geometry_->ToRoadPosition(off_road);
+  const api::RoadPositionResult result = dut.Localize(off_road);
+  EXPECT_EQ(expected.road_position.lane, result.road_position.lane);
+  EXPECT_NEAR(expected.distance, result.distance, kDistanceThreshold);
+  EXPECT_EQ(2, dut.num_fallbacks());
+  EXPECT_EQ(0, dut.num_hint_hits());
+
+  dut.Reset();
+  ExpectLocalizes(right_lane_, 10., 0., &dut);
+  EXPECT_EQ(3, dut.num_fallbacks());
+}
+
+}  // namespace
+}  // namespace integration
+}  // namespace maliput